@@ -37,6 +37,10 @@
     2014 Aug 13  James Stokebrand   Initial version.
     2014 Aug 24  James Stokebrand   Created interrupt version 
                                      of the ButtonClass
+    2026 Oct 17  agent              Interrupt updates use the
+                                     pin snapshot of the ISR.
+    2026 Oct 17  agent              Subject type follows
+                                     STATIC_OBSERVERS.
 
 *****************************************************/
 
@@ -122,7 +126,19 @@ public:
     bool CheckStatus(void)
     {
         // Read the pin associated with this button
-        E_InputEvent temp = Read() ? E_BUTTON_IS_PRESSED : E_BUTTON_IS_RELEASED;
+        return CheckStatus(Read());
+    }
+
+    // Level of the pin in the snapshot of the pin change being processed
+    bool Sampled(void)
+    {
+        if (_Subject) return _Subject->Level(_Bit);
+        return Read();
+    }
+
+    bool CheckStatus(bool const &level)
+    {
+        E_InputEvent temp = level ? E_BUTTON_IS_PRESSED : E_BUTTON_IS_RELEASED;
         // Did its status change?
         if (get_current_event() != temp)
         {
@@ -135,7 +151,7 @@ public:
 
     void Update()
     { 
-        if(CheckStatus())
+        if(CheckStatus(Sampled()))
         {
             // The status changed ... notify observer
             event_element_class A(get_current_hardware(),get_current_event());
@@ -144,7 +160,7 @@ public:
     }
 
     // Store its interrupt subject.
-    InterruptSubjectPinIntr *_Subject;
+    PinIntrSubject *_Subject;
 private:
 };
 
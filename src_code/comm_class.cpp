@@ -56,8 +56,9 @@ void comm_class::Update(event_element_class const &A)
     if ((A.get_current_event() == E_UART_FLAG_BYTE_FOUND_EVENT) ||
         (A.get_current_event() == E_UART_RX_EVENT))
     {
+        // Several msgs may be waiting when the decoding is deferred
         event_element_class temp;
-        if (decode(temp))
+        while (decode(temp))
         {
             Notify(temp);
         }
@@ -85,13 +86,56 @@ void comm_class::encode(event_element_class const &A)
     _UartClass.putc(UartBaseClass::COMM_CLASS_FLAG_BYTE);
 }
 
+void comm_class::capture(event_element_class const &A, uint16_t const &stamp)
+{
+    _UartClass.putc(UartBaseClass::COMM_CLASS_FLAG_BYTE);
+    byte_stuff(A.get_current_hardware());
+    byte_stuff(A.get_current_event());
+    byte_stuff(A.get_current_data());
+    byte_stuff(stamp & 0xFF);
+    byte_stuff(stamp >> 8);
+    _UartClass.putc(UartBaseClass::COMM_CLASS_FLAG_BYTE);
+}
+
+void comm_class::report_start(uint8_t const &A)
+{
+    _report_checksum = 0;
+    encode(event_element_class(E_RGB_CONTROLLER, E_REPORT_START, A));
+}
+
+void comm_class::report_data(uint8_t const &A)
+{
+    _report_checksum += A;
+    encode(event_element_class(E_RGB_CONTROLLER, E_REPORT_DATA, A));
+}
+
+void comm_class::report_data16(uint16_t const &A)
+{
+    // Little endian
+    report_data(A & 0xFF);
+    report_data(A >> 8);
+}
+
+void comm_class::report_data32(uint32_t const &A)
+{
+    // Little endian
+    report_data16(A & 0xFFFF);
+    report_data16(A >> 16);
+}
+
+void comm_class::report_end()
+{
+    encode(event_element_class(E_RGB_CONTROLLER, E_REPORT_END, _report_checksum));
+}
+
 bool comm_class::decode(event_element_class &A)
 {
     static uint8_t position;
     static uint8_t msg[MAX_SEARCH_BUFFER_SIZE];
 
-    // Are there char's to process?
-    while (!_UartClass.isEmpty())
+    // Are there char's to process?  Stop at the end of a msg, the
+    //  rest is decoded on the next call.
+    while (!_UartClass.isEmpty() && !current_receive_msg._MsgValid)
     { 
         process(msg, position);
     }
@@ -167,15 +211,6 @@ void comm_class::STATE_decode__flag_byte_found(uint8_t *msg, uint8_t &pos)
             TRAN((STATE)&comm_class::STATE_decode__byte_thin);
             return;
         }
-#if 1
-        else if (pos >= MAX_SEARCH_BUFFER_SIZE-1)
-        {
-            // msg buffer is out of space ... still haven't found 
-            // the next FLAG Byte
-            // Transition back to searching for a flag byte
-            TRAN((STATE)&comm_class::STATE_decode__search_for_flag_byte);
-        }
-#endif
 
         // This is the start of the msg ... store it.
         msg[pos++] = data;
@@ -223,16 +258,15 @@ void comm_class::STATE_decode__collect_msg(uint8_t *msg, uint8_t &pos)
             TRAN((STATE)&comm_class::STATE_decode__byte_thin);            
             return;
         }
-#if 1
         else if (pos >= MAX_SEARCH_BUFFER_SIZE-1)
         {
             // msg buffer is out of space ... still haven't found 
-            // the complete msg
+            // the complete msg.  Drop it.
 
             // Transition back to searching for a flag byte
             TRAN((STATE)&comm_class::STATE_decode__search_for_flag_byte);
+            return;
         }
-#endif
 
         // No flag byte found, slurp up more of the msg.
         msg[pos++] = data;
@@ -246,6 +280,21 @@ void comm_class::STATE_decode__byte_thin(uint8_t *msg, uint8_t &pos)
     uint8_t data;
     if (_UartClass.getc(error, data))
     {
+        if (data == UartBaseClass::COMM_CLASS_FLAG_BYTE)
+        {
+            // A flag byte is never stuffed.  The sender aborted the
+            //  msg ... drop it, this flag byte starts the next one.
+            pos = 0;
+            TRAN((STATE)&comm_class::STATE_decode__flag_byte_found);
+            return;
+        }
+        else if (pos >= MAX_SEARCH_BUFFER_SIZE-1)
+        {
+            // msg buffer is out of space ... drop the msg.
+            TRAN((STATE)&comm_class::STATE_decode__search_for_flag_byte);
+            return;
+        }
+
         // byte thin this byte by XOR and store it in the raw msg buffer
         msg[pos++] = data ^ UartBaseClass::COMM_CLASS_BYTE_STUFF_XOR_VALUE;
 
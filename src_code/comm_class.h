@@ -49,6 +49,7 @@ class comm_class
 public:
     comm_class()
     :_UartClass(E_UART_00)
+    ,_report_checksum(0)
     {
         _UartClass.Attach(this);
 
@@ -78,6 +79,22 @@ public:
     // Rx and Decode an Event Msg
     bool decode(event_element_class &A);
 
+    // Send a captured event (EVENT_CAPTURE):
+    //  Hardware ID, Event ID, Data, Timebase stamp (2 bytes, little endian)
+    //  The 5 byte msg fails the length check of the nodes and is ignored
+    //  by them.  See tools/event_replay.cpp
+    void capture(event_element_class const &A, uint16_t const &stamp);
+
+    // Send a diagnostic report as a burst of event msgs:
+    //  E_REPORT_START (data = report ID)
+    //  E_REPORT_DATA  (data = one byte of the report) ...
+    //  E_REPORT_END   (data = 8 bit sum of the report bytes)
+    void report_start(uint8_t const &A);
+    void report_data(uint8_t const &A);
+    void report_data16(uint16_t const &A);
+    void report_data32(uint32_t const &A);
+    void report_end();
+
     virtual void Update(event_element_class const &A);
 
 private:
@@ -134,6 +151,9 @@ private:
 
     UartBaseClass _UartClass;
 
+    // Running sum of the report being sent
+    uint8_t _report_checksum;
+
     static const uint8_t MAX_SEARCH_BUFFER_SIZE = 32;
 };
 
@@ -0,0 +1,151 @@
+/****************************************************
+    Deferred Work
+
+    File:   deferred_work.cpp
+    Author: agent
+    agent AT local
+
+    deferred_work.cpp file is part of the RGB LED Controller and Node 
+     version 1 hardware project.
+
+    This file contains the deferred work queue.  See deferred_work.h.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+    2026 Oct 17  agent              Overflow count taken atomically.
+
+*****************************************************/
+
+#include <util/atomic.h>
+
+#ifndef _DEFERRED_WORK_H_
+#include "deferred_work.h"
+#endif
+
+#ifndef _COMM_CLASS_H_
+#include "comm_class.h"
+#endif
+
+deferred_work::work_type deferred_work::_Work[E_WORK_LAST];
+
+#if DEFERRED_WORK
+
+STATIC_QUEUE_EVENT_LISTING::cqueue<deferred_work::work_item, DEFERRED_WORK_SIZE> deferred_work::_Queue;
+uint16_t deferred_work::_Overflows = 0;
+uint16_t deferred_work::_LongestDeferral = 0;
+
+bool deferred_work::Post(E_WorkID const A, uint8_t const B)
+{
+    work_item item;
+    item._ID = A;
+    item._Data = B;
+#if TIMEBASE_IN_USE
+    item._Posted = timebase_class::NowFromIsr();
+#endif
+
+    if (!_Queue.Enqueue(item))
+    {
+        // The PWM frame work posts with interrupts enabled
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+        {
+            if (_Overflows != 0xFFFF) _Overflows++;
+        }
+        return false;
+    }
+    return true;
+}
+
+void deferred_work::Run()
+{
+    work_item item;
+
+    while (_Queue.Dequeue(item))
+    {
+#if TIMEBASE_IN_USE
+        uint16_t const deferral = timebase_class::Now() - item._Posted;
+        if (deferral > _LongestDeferral) _LongestDeferral = deferral;
+#endif
+        if (_Work[item._ID]) _Work[item._ID](item._Data);
+    }
+}
+
+bool deferred_work::IsEmpty()
+{
+    return _Queue.IsEmpty();
+}
+
+void deferred_work::Clear()
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        _Overflows = 0;
+        _LongestDeferral = 0;
+    }
+}
+
+void deferred_work::Report(comm_class &aComm, bool const &clear)
+{
+    uint16_t overflows;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        overflows = _Overflows;
+    }
+
+    // Longest deferral in timebase ticks, 0 without a timebase
+    uint8_t prescale_log2 = 0;
+    while ((1UL << prescale_log2) < TIMEBASE_PRESCALE) prescale_log2++;
+
+    aComm.report_data(prescale_log2);
+    aComm.report_data16(_Queue.CAPACITY);
+    aComm.report_data16(_Queue.HighWaterMark());
+    aComm.report_data16(overflows);
+    aComm.report_data16(_LongestDeferral);
+
+    if (clear) Clear();
+}
+
+#else
+
+bool deferred_work::Post(E_WorkID const A, uint8_t const B)
+{
+    // Not deferred ... do the work inside the ISR
+    if (_Work[A]) _Work[A](B);
+    return true;
+}
+
+void deferred_work::Run()
+{
+}
+
+bool deferred_work::IsEmpty()
+{
+    return true;
+}
+
+void deferred_work::Clear()
+{
+}
+
+void deferred_work::Report(comm_class &, bool const &)
+{
+    // Not built in ... empty report.
+}
+
+#endif
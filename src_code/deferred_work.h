@@ -0,0 +1,115 @@
+#ifndef _DEFERRED_WORK_H_
+#define _DEFERRED_WORK_H_
+
+/****************************************************
+    Deferred Work
+
+    File:   deferred_work.h
+    Author: agent
+    agent AT local
+
+    deferred_work.h file is part of the RGB LED Controller and Node 
+     version 1 hardware project.
+
+    This file contains the deferred work queue.  An ISR posts a work
+     item (work id and one byte) and returns, the main loop runs the
+     work before it dispatches the events.  The pin change and USART
+     RX vectors use it, their observers and the comm class decoding
+     no longer run in interrupt context.  DEFERRED_WORK=0 in the
+     Makefile runs the work right away inside the ISR.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+    2026 Oct 17  agent              PWM fade completion.
+
+*****************************************************/
+
+#include <avr/io.h>
+
+#ifndef _STATIC_QUEUE_H_
+#include "static_queue.h"
+#endif
+
+#ifndef _TIMEBASE_CLASS_H_
+#include "timebase_class.h"
+#endif
+
+// Work items the ISRs can have outstanding (power of two).  Set in
+//  the Makefile.
+#ifndef DEFERRED_WORK_SIZE
+#define DEFERRED_WORK_SIZE 16
+#endif
+
+class comm_class;
+
+class deferred_work
+{
+public:
+    typedef enum {
+         E_WORK_PCINT0    // Byte is the PINB snapshot
+        ,E_WORK_PCINT1    // Byte is the PINC snapshot
+        ,E_WORK_PCINT2    // Byte is the PIND snapshot
+        ,E_WORK_USART_RX  // Byte is the first byte received
+        ,E_WORK_PWM_FADE  // Byte is the fade slot that ended
+
+        // Must remain the last enum
+        ,E_WORK_LAST
+    } E_WorkID;
+
+    typedef void (*work_type)(uint8_t const &A);
+
+    // The owner of a work id registers the code that does the work
+    static void Register(E_WorkID const A, work_type const B)
+    {
+        _Work[A] = B;
+    }
+
+    // ISR side.  False when the queue is full and the work is lost.
+    static bool Post(E_WorkID const A, uint8_t const B);
+
+    // Main loop side.  Runs every work item posted so far.
+    static void Run();
+
+    static bool IsEmpty();
+
+    static void Clear();
+
+    // Queue depth, overflows and longest deferral (E_REPORT_DEFERRED_WORK)
+    static void Report(comm_class &aComm, bool const &clear);
+
+private:
+    struct work_item {
+        uint8_t _ID;
+        uint8_t _Data;
+#if TIMEBASE_IN_USE
+        uint16_t _Posted;
+#endif
+    };
+
+    static work_type _Work[E_WORK_LAST];
+
+#if DEFERRED_WORK
+    static STATIC_QUEUE_EVENT_LISTING::cqueue<work_item, DEFERRED_WORK_SIZE> _Queue;
+    static uint16_t _Overflows;
+    static uint16_t _LongestDeferral;
+#endif
+};
+
+#endif
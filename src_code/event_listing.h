@@ -35,6 +35,11 @@
     2014 Aug 05  James Stokebrand   Initial creation.
     2014 Aug 06  James Stokebrand   Updated to separate hardware with
                                       Possible events
+    2026 Oct 17  agent              event_element_class is a trivially
+                                      copyable 3 byte record.
+    2026 Oct 17  agent              PWM fade engine events.
+    2026 Oct 17  agent              E_RE_CW/E_RE_CCW msgs carry a step
+                                      count.
 
 *****************************************************/
 
@@ -75,6 +80,9 @@ typedef enum {
     // BlinkM Hardware (makes use of TWI)
     ,E_BLINKM_01          // 0x0D
 
+    // PWM fade engine
+    ,E_PWM_FADE_01        // 0x0E
+
     // Must be the last item on the list
     ,E_LAST_HARDWARE_EVENT
 } E_InputHardware;
@@ -96,6 +104,7 @@ typedef enum {
     ,E_UART_FLAG_BYTE_FOUND_EVENT // 0x07
 
     // Rotary Encoder specific
+    //  Data is the number of steps (1 .. ROTARY_ENCODER_MAX_STEPS)
     ,E_ROTARY_ENCODER_ROTATED_CW  // 0x08
     ,E_ROTARY_ENCODER_ROTATED_CCW // 0x09
 
@@ -103,6 +112,10 @@ typedef enum {
     ,E_ENTER_STATE        // 0x0A
     ,E_EXIT_STATE         // 0x0B
 
+    // PWM fade engine specific
+    //  Data is the fade ID given to pwm_fade_class::start()
+    ,E_PWM_FADE_COMPLETE  // 0x0C
+
     // RGB Controller specific
     //  RGB Color methods
     ,E_SET_RED             = 0x10
@@ -117,6 +130,8 @@ typedef enum {
     ,E_SET_DELAY          // 0x17
     ,E_SET_FADE           // 0x18
     //  Rotary Encoder
+    //   Data is the node address (bits 0..3) and the steps - 1
+    //   (bits 4..7), see RE_MSG_DATA()
     ,E_RE_CW              // 0x19
     ,E_RE_CCW             // 0x1A
     ,E_RE_PRESSED         // 0x1B
@@ -136,6 +151,12 @@ typedef enum {
     ,E_ENABLE_STATUS_LED  // 0x25
     ,E_DISABLE_STATUS_LED // 0x26
 
+    // Diagnostic reports (see E_ReportID)
+    ,E_REPORT_REQUEST     // 0x27 Data is the E_ReportID requested
+    ,E_REPORT_START       // 0x28 Data is the E_ReportID being sent
+    ,E_REPORT_DATA        // 0x29 Data is one byte of the report
+    ,E_REPORT_END         // 0x2A Data is the 8 bit sum of the report bytes
+
     // RGB Node specific
     //  RGB Color
     ,E_LED_RED_PWM         = 0x30
@@ -198,6 +219,45 @@ typedef enum {
     ,E_LAST_INPUT_EVENT
 } E_InputEvent;
 
+// Most steps a single rotary encoder event carries
+#define ROTARY_ENCODER_MAX_STEPS 16
+
+// Most steps a single E_RE_CW/E_RE_CCW msg carries, 1 .. 16.
+//  1 sends the address alone, one msg per step, as nodes that don't
+//  read the step count expect.
+#ifndef ROTARY_ENCODER_MSG_STEPS
+#define ROTARY_ENCODER_MSG_STEPS 16
+#endif
+#if (ROTARY_ENCODER_MSG_STEPS < 1) || (ROTARY_ENCODER_MSG_STEPS > 16)
+#error "ROTARY_ENCODER_MSG_STEPS must be 1 .. 16"
+#endif
+
+// Data byte of the E_RE_CW/E_RE_CCW msgs: node address and steps.
+//  A single step is the address alone.
+#define RE_MSG_DATA(address, steps) ((uint8_t)(((address) & 0x0F) | (((steps) - 1) << 4)))
+#define RE_MSG_ADDRESS(data) ((uint8_t)((data) & 0x0F))
+#define RE_MSG_STEPS(data) ((uint8_t)(((data) >> 4) + 1))
+
+// Diagnostic reports sent by the RGB Controller on E_REPORT_REQUEST
+typedef enum {
+     E_REPORT_ISR_PROFILE  = 0x01 // ISR durations (see isr_profile.h)
+    ,E_REPORT_EVENT_LATENCY       // 0x02 Event pipeline latency (see event_trace.h)
+    ,E_REPORT_RAM_USAGE           // 0x03 Static/heap/stack RAM usage (see ram_usage.h)
+    ,E_REPORT_POWER_STATS         // 0x04 Sleep residency and wake sources (see power_stats.h)
+    ,E_REPORT_EVENT_QUEUE         // 0x05 Event queue class high water marks and drops (see event_queue.h)
+    ,E_REPORT_DEFERRED_WORK       // 0x06 Deferred work queue depth and longest deferral (see deferred_work.h)
+
+    // Must remain the last item on the list
+    ,E_LAST_REPORT_ID
+} E_ReportID;
+
+// Set in the E_REPORT_REQUEST data to clear the statistics once sent
+#define REPORT_CLEAR_FLAG 0x80
+
+// One event: hardware, event and data byte.  No vtable and the
+//  compiler generated copy, so a queue slot is 3 bytes and copying
+//  one is three byte moves.  The hardware classes derive from it
+//  to hold the event they notify.
 class event_element_class
 {
 public:
@@ -209,8 +269,6 @@ public:
     , theData(C)
     {}
 
-    virtual ~event_element_class() {}
-
     void set(E_InputHardware const A, E_InputEvent const B, uint8_t const C=0)
     {
         aHardware = A;
@@ -227,19 +285,19 @@ public:
 
     void get(E_InputHardware &A, E_InputEvent &B, uint8_t &C)
     {
-        A = aHardware;
-        B = anEvent;
+        A = (E_InputHardware)aHardware;
+        B = (E_InputEvent)anEvent;
         C = theData;
     }
 
     void get(event_element_class &A)
     {
-        A.set(aHardware, anEvent, theData);
+        A = *this;
     }
 
     E_InputHardware get_current_hardware() const
     {
-        return aHardware;
+        return (E_InputHardware)aHardware;
     }
 
     void set_current_hardware(E_InputHardware const &A)
@@ -249,7 +307,7 @@ public:
 
     E_InputEvent get_current_event() const
     {
-        return anEvent;
+        return (E_InputEvent)anEvent;
     }
 
     void set_current_event(E_InputEvent const &A)
@@ -287,25 +345,22 @@ public:
         return false;
     }
 
-    event_element_class& operator = (event_element_class const &A) {
-        if (this != &A)
-        {
-            set(A.aHardware,A.anEvent,A.theData);
-        }
-        return *this;
-    }
-
     void clear()
     {
         set(E_LAST_HARDWARE_EVENT,E_LAST_INPUT_EVENT,0);
     }
 
 private:
-    E_InputHardware aHardware;
-    E_InputEvent anEvent;
+    // Stored as bytes, the enums are only 1 byte with -fshort-enums
+    uint8_t aHardware;
+    uint8_t anEvent;
     uint8_t theData;
 };
 
+static_assert(sizeof(event_element_class) == 3, "event_element_class must stay a 3 byte record");
+static_assert(__has_trivial_copy(event_element_class) && __has_trivial_destructor(event_element_class)
+             ,"event_element_class must stay trivially copyable");
+
 
 #endif
 
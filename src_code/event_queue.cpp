@@ -0,0 +1,149 @@
+/****************************************************
+    Event Queue
+
+    File:   event_queue.cpp
+    Author: agent
+    agent AT local
+
+    event_queue.cpp file is part of the RGB LED Controller and Node 
+     version 1 hardware project.
+
+    This file contains the statistics of the priority classes of the
+     Event Queue.  See event_queue.h.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+
+*****************************************************/
+
+#include <util/atomic.h>
+
+#ifndef _EVENT_QUEUE_H_
+#include "event_queue.h"
+#endif
+
+#ifndef _COMM_CLASS_H_
+#include "comm_class.h"
+#endif
+
+uint16_t EventQueue::Capacity(E_EventClass const A)
+{
+    switch (A)
+    {
+    case E_CLASS_INTERACTIVE: return _Interactive.CAPACITY;
+    case E_CLASS_TIMER:       return _Timer.CAPACITY;
+    case E_CLASS_BULK:        return _Bulk.CAPACITY;
+    default:                  return 0;
+    }
+}
+
+uint16_t EventQueue::HighWaterMark(E_EventClass const A)
+{
+    switch (A)
+    {
+    case E_CLASS_INTERACTIVE: return _Interactive.HighWaterMark();
+    case E_CLASS_TIMER:       return _Timer.HighWaterMark();
+    case E_CLASS_BULK:        return _Bulk.HighWaterMark();
+    default:                  return 0;
+    }
+}
+
+uint16_t EventQueue::Drops(E_EventClass const A)
+{
+    if (A >= E_CLASS_LAST) return 0;
+
+    uint16_t drops;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        drops = _Drops[A];
+    }
+    return drops;
+}
+
+uint16_t EventQueue::Drops(E_InputHardware const A)
+{
+    if (A >= E_LAST_HARDWARE_EVENT) return 0;
+
+    uint16_t drops;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        drops = _SourceDrops[A];
+    }
+    return drops;
+}
+
+void EventQueue::ClearStats(void)
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        for (uint8_t i = 0; i < E_CLASS_LAST; i++)
+        {
+            _Drops[i] = 0;
+        }
+        for (uint8_t i = 0; i < E_LAST_HARDWARE_EVENT; i++)
+        {
+            _SourceDrops[i] = 0;
+        }
+    }
+}
+
+void EventQueue::Report(comm_class &aComm, bool const &clear)
+{
+    aComm.report_data(E_CLASS_LAST);
+    for (uint8_t i = 0; i < E_CLASS_LAST; i++)
+    {
+        E_EventClass const aClass = (E_EventClass)i;
+        aComm.report_data16(Capacity(aClass));
+        aComm.report_data16(HighWaterMark(aClass));
+        aComm.report_data16(Drops(aClass));
+    }
+
+    aComm.report_data(E_LAST_HARDWARE_EVENT);
+    for (uint8_t i = 0; i < E_LAST_HARDWARE_EVENT; i++)
+    {
+        aComm.report_data16(Drops((E_InputHardware)i));
+    }
+
+    if (clear) ClearStats();
+}
+
+#if EVENT_STAMP
+
+uint16_t EventQueue::LastEnqueueStamp(void)
+{
+    switch (_LastClass)
+    {
+    case E_CLASS_INTERACTIVE: return _Interactive.LastEnqueueStamp();
+    case E_CLASS_TIMER:       return _Timer.LastEnqueueStamp();
+    default:                  return _Bulk.LastEnqueueStamp();
+    }
+}
+
+uint16_t EventQueue::LastDequeueStamp(void)
+{
+    switch (_LastClass)
+    {
+    case E_CLASS_INTERACTIVE: return _Interactive.LastDequeueStamp();
+    case E_CLASS_TIMER:       return _Timer.LastDequeueStamp();
+    default:                  return _Bulk.LastDequeueStamp();
+    }
+}
+
+#endif
@@ -14,6 +14,11 @@
     This file defines the Event Queue class.  Events are generated by ISRs
      (IE buttons, timers, UART/Comm events etc) and serializes them
      for later use in software state machines.  This queue is ISR safe.
+
+    The events are split in priority classes, each with its own queue
+     and its own share of the slots.  A flood of comm messages fills
+     the bulk queue only, button and rotary encoder events still get
+     in and are dequeued first.
      
     Copyright (C) 2015 - James Stokebrand - 2015 Mar 12
 
@@ -34,6 +39,16 @@
      When         Who                Description of change
     -----------  ----------         ------------------------
     2014 Oct 05  James Stokebrand   Initial creation.
+    2026 Oct 17  agent              Priority classes with per class
+                                      quotas and drop counters.
+    2026 Oct 17  agent              Rotary encoder steps merged.
+    2026 Oct 17  agent              Batch dequeue.
+    2026 Oct 17  agent              Overflow policies, drops per source.
+    2026 Oct 17  agent              PWM fades complete in the timer
+                                      class.
+    2026 Oct 17  agent              Drops counted with interrupts
+                                      masked.
+    2026 Oct 17  agent              Batch dequeue masks per element.
 
 *****************************************************/
 
@@ -50,14 +65,76 @@
 #include "static_queue.h"
 #endif
 
+// Slots of each priority class (powers of two).  Set in the Makefile.
+#ifndef EVENT_QUEUE_INTERACTIVE_SIZE
+#define EVENT_QUEUE_INTERACTIVE_SIZE 8
+#endif
+
+#ifndef EVENT_QUEUE_TIMER_SIZE
+#define EVENT_QUEUE_TIMER_SIZE 4
+#endif
+
+#ifndef EVENT_QUEUE_BULK_SIZE
+#define EVENT_QUEUE_BULK_SIZE 16
+#endif
+
+// What a full class sheds (QUEUE_DROP_NEWEST, QUEUE_DROP_OLDEST or
+//  QUEUE_DROP_LOWEST, see static_queue.h).  Set in the Makefile.
+#ifndef EVENT_QUEUE_INTERACTIVE_POLICY
+#define EVENT_QUEUE_INTERACTIVE_POLICY QUEUE_DROP_LOWEST
+#endif
+
+#ifndef EVENT_QUEUE_TIMER_POLICY
+#define EVENT_QUEUE_TIMER_POLICY QUEUE_DROP_OLDEST
+#endif
+
+#ifndef EVENT_QUEUE_BULK_POLICY
+#define EVENT_QUEUE_BULK_POLICY QUEUE_DROP_NEWEST
+#endif
+
+// Most events the main loop takes out of the EventQueue at once.
+//  Set in the Makefile.
+#ifndef EVENT_BATCH_SIZE
+#define EVENT_BATCH_SIZE 4
+#endif
+
+class comm_class;
+
+// Events dequeued together, highest priority class first
+class event_batch
+{
+public:
+    event_batch()
+    : count(0)
+    {}
+
+    uint8_t count;
+    event_element_class event[EVENT_BATCH_SIZE];
+#if EVENT_STAMP
+    uint16_t enqueued[EVENT_BATCH_SIZE]; // Timebase stamp of each Enqueue
+    uint16_t dequeued;                   // Timebase stamp of the Dequeue
+#endif
+};
+
 class EventQueue
-: public STATIC_QUEUE_EVENT_LISTING::cqueue
-, public EventObserver
+: public EventObserver
 {
 public:
 
+    // Priority classes, highest first
+    typedef enum
+    {
+         E_CLASS_INTERACTIVE = 0 // Buttons and rotary encoder
+        ,E_CLASS_TIMER           // Timer expirations and PWM fades
+        ,E_CLASS_BULK            // Comm messages and everything else
+        ,E_CLASS_LAST
+    } E_EventClass;
+
     EventQueue()
-    {}
+    : _LastClass(E_CLASS_INTERACTIVE)
+    {
+        ClearStats();
+    }
 
     virtual ~EventQueue() {}
 
@@ -66,7 +143,192 @@ public:
         // All EventQueue objects will have a event_element_class as a member.
         Enqueue(A);
     }
+
+    static E_EventClass Classify(E_InputHardware const A)
+    {
+        switch (A)
+        {
+        case E_BUTTON_01:
+        case E_BUTTON_02:
+        case E_BUTTON_03:
+        case E_BUTTON_04:
+        case E_ROTARY_ENCODER_01:
+            return E_CLASS_INTERACTIVE;
+        case E_TIMER_01:
+        case E_PWM_FADE_01:
+            return E_CLASS_TIMER;
+        default:
+            return E_CLASS_BULK;
+        }
+    }
+
+    // Rotations of the rotary encoder still waiting in the queue add
+    //  their steps to the newest one when it turns the same way.
+    static bool MergeRotation(event_element_class &queued, event_element_class const &A)
+    {
+        E_InputEvent const anEvent = A.get_current_event();
+
+        if ((A.get_current_hardware() != E_ROTARY_ENCODER_01) ||
+            ((anEvent != E_ROTARY_ENCODER_ROTATED_CW) && (anEvent != E_ROTARY_ENCODER_ROTATED_CCW)) ||
+            (queued.get_current_hardware() != E_ROTARY_ENCODER_01) ||
+            (queued.get_current_event() != anEvent))
+        {
+            return false;
+        }
+
+        uint8_t const steps = queued.get_current_data() + A.get_current_data();
+        if (steps > ROTARY_ENCODER_MAX_STEPS)
+        {
+            return false;
+        }
+
+        queued.set_current_data(steps);
+        return true;
+    }
+
+    // Rank for QUEUE_DROP_LOWEST.  A lost button release leaves the
+    //  state machine in a pressed state, a lost rotation step or
+    //  comm msg only loses that update.
+    static uint8_t Rank(event_element_class const &A)
+    {
+        switch (A.get_current_event())
+        {
+        case E_BUTTON_IS_PRESSED:
+        case E_BUTTON_IS_RELEASED:
+            return 2;
+        case E_TIMER_EXPIRE:
+            return 1;
+        default:
+            return 0;
+        }
+    }
+
+    // Producer side (ISR or main loop).  A full class sheds an event
+    //  as set by its policy and counts it, the other classes are not
+    //  affected.
+    bool Enqueue(event_element_class const &A)
+    {
+        E_EventClass const aClass = Classify(A.get_current_hardware());
+        event_element_class dropped;
+        bool kept;
+
+        switch (aClass)
+        {
+        case E_CLASS_INTERACTIVE:
+            kept = _Interactive.Enqueue(A, &MergeRotation, dropped);
+        break;
+        case E_CLASS_TIMER:
+            kept = _Timer.Enqueue(A, dropped);
+        break;
+        default:
+            kept = _Bulk.Enqueue(A, dropped);
+        break;
+        }
+
+        if (!kept)
+        {
+            CountDrop(aClass, dropped.get_current_hardware());
+        }
+        return kept;
+    }
+
+    // Consumer side (main loop).  Highest priority class first.
+    bool Dequeue(event_element_class &A)
+    {
+        if (_Interactive.DequeueLocked(A))
+        {
+            _LastClass = E_CLASS_INTERACTIVE;
+            return true;
+        }
+        if (_Timer.Dequeue(A))
+        {
+            _LastClass = E_CLASS_TIMER;
+            return true;
+        }
+        if (_Bulk.Dequeue(A))
+        {
+            _LastClass = E_CLASS_BULK;
+            return true;
+        }
+        return false;
+    }
+
+    // Consumer side (main loop).  Fills the batch in priority order,
+    //  false when there was nothing.  Interrupts are masked for one
+    //  element copy at a time (cqueue::DequeueBatch()).
+    bool Dequeue(event_batch &B)
+    {
+        B.count = _Interactive.DequeueBatch(B.event, Stamps(B), EVENT_BATCH_SIZE);
+        B.count += _Timer.DequeueBatch(B.event + B.count, Stamps(B), EVENT_BATCH_SIZE - B.count);
+        B.count += _Bulk.DequeueBatch(B.event + B.count, Stamps(B), EVENT_BATCH_SIZE - B.count);
+#if EVENT_STAMP
+        B.dequeued = timebase_class::Now();
+#endif
+        return B.count != 0;
+    }
+
+    inline bool IsEmpty(void)
+    {
+        return _Interactive.IsEmpty() && _Timer.IsEmpty() && _Bulk.IsEmpty();
+    }
+
+    uint16_t Capacity(E_EventClass const A);
+    uint16_t HighWaterMark(E_EventClass const A);
+
+    // Events lost because their class was full
+    uint16_t Drops(E_EventClass const A);
+
+    // Events of a hardware source lost to a full class
+    uint16_t Drops(E_InputHardware const A);
+
+    void ClearStats(void);
+
+    // Per class capacity, high water mark and drops, then the drops
+    //  per hardware source (E_REPORT_EVENT_QUEUE)
+    void Report(comm_class &aComm, bool const &clear);
+
+#if EVENT_STAMP
+    // Timebase stamps of the last event dequeued
+    uint16_t LastEnqueueStamp(void);
+    uint16_t LastDequeueStamp(void);
+#endif
+
 private:
+    // Where the next enqueue stamps of the batch go
+    static uint16_t *Stamps(event_batch &B)
+    {
+#if EVENT_STAMP
+        return B.enqueued + B.count;
+#else
+        (void)B;
+        return 0;
+#endif
+    }
+
+    // The ISRs and the main loop (deferred work, fade completions)
+    //  both enqueue.  The read-modify-write of the 16 bit counters
+    //  can't be split by an ISR.
+    void CountDrop(E_EventClass const aClass, E_InputHardware const aSource)
+    {
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+            if (_Drops[aClass] != 0xFFFF) _Drops[aClass]++;
+            if ((aSource < E_LAST_HARDWARE_EVENT) && (_SourceDrops[aSource] != 0xFFFF))
+            {
+                _SourceDrops[aSource]++;
+            }
+        }
+    }
+
+    STATIC_QUEUE_EVENT_LISTING::cqueue<event_element_class, EVENT_QUEUE_INTERACTIVE_SIZE
+                                      ,EVENT_QUEUE_INTERACTIVE_POLICY, Rank> _Interactive;
+    STATIC_QUEUE_EVENT_LISTING::cqueue<event_element_class, EVENT_QUEUE_TIMER_SIZE
+                                      ,EVENT_QUEUE_TIMER_POLICY, Rank> _Timer;
+    STATIC_QUEUE_EVENT_LISTING::cqueue<event_element_class, EVENT_QUEUE_BULK_SIZE
+                                      ,EVENT_QUEUE_BULK_POLICY, Rank> _Bulk;
+
+    volatile uint16_t _Drops[E_CLASS_LAST];
+    volatile uint16_t _SourceDrops[E_LAST_HARDWARE_EVENT];
+    E_EventClass _LastClass;
 };
 
 #endif
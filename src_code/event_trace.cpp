@@ -0,0 +1,121 @@
+/****************************************************
+    Event Trace
+
+    File:   event_trace.cpp
+    Author: agent
+    agent AT local
+
+    event_trace.cpp file is part of the RGB LED Controller and Node 
+     version 1 hardware project.
+
+    This file contains the event latency histograms and their report.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+
+*****************************************************/
+
+#ifndef _EVENT_TRACE_H_
+#include "event_trace.h"
+#endif
+
+#ifndef _COMM_CLASS_H_
+#include "comm_class.h"
+#endif
+
+#if EVENT_TRACE
+
+const uint8_t event_trace::HISTOGRAM_BUCKETS;
+
+uint8_t event_trace::_Histogram[E_LAST_HARDWARE_EVENT][HISTOGRAM_BUCKETS];
+uint16_t event_trace::_MaxResidency[E_LAST_HARDWARE_EVENT];
+uint16_t event_trace::_MaxLatency[E_LAST_HARDWARE_EVENT];
+
+void event_trace::Record(E_InputHardware const &A
+                        ,uint16_t const &enqueued
+                        ,uint16_t const &dequeued)
+{
+    if (A >= E_LAST_HARDWARE_EVENT) return;
+
+    uint16_t const latency = timebase_class::Now() - enqueued;
+    uint16_t const residency = dequeued - enqueued;
+
+    if (residency > _MaxResidency[A]) _MaxResidency[A] = residency;
+    if (latency > _MaxLatency[A]) _MaxLatency[A] = latency;
+
+    // log2 bucket ... number of significant bits
+    uint8_t bucket = 0;
+    for (uint16_t temp = latency; temp != 0; temp >>= 1) bucket++;
+    if (bucket >= HISTOGRAM_BUCKETS) bucket = HISTOGRAM_BUCKETS - 1;
+
+    if (_Histogram[A][bucket] != 0xFF) _Histogram[A][bucket]++;
+}
+
+void event_trace::Clear()
+{
+    for (uint8_t i = 0; i < E_LAST_HARDWARE_EVENT; i++)
+    {
+        for (uint8_t j = 0; j < HISTOGRAM_BUCKETS; j++)
+        {
+            _Histogram[i][j] = 0;
+        }
+        _MaxResidency[i] = 0;
+        _MaxLatency[i] = 0;
+    }
+}
+
+void event_trace::Report(comm_class &aComm, bool const &clear)
+{
+    uint8_t prescale_log2 = 0;
+    while ((1UL << prescale_log2) < TIMEBASE_PRESCALE) prescale_log2++;
+
+    aComm.report_data(prescale_log2);
+    aComm.report_data(HISTOGRAM_BUCKETS);
+
+    // Only the main loop touches these tables ... no locking needed.
+    for (uint8_t i = 0; i < E_LAST_HARDWARE_EVENT; i++)
+    {
+        bool used = false;
+        for (uint8_t j = 0; j < HISTOGRAM_BUCKETS; j++)
+        {
+            if (_Histogram[i][j]) used = true;
+        }
+        if (!used) continue;
+
+        aComm.report_data(i);
+        aComm.report_data16(_MaxResidency[i]);
+        aComm.report_data16(_MaxLatency[i]);
+        for (uint8_t j = 0; j < HISTOGRAM_BUCKETS; j++)
+        {
+            aComm.report_data(_Histogram[i][j]);
+        }
+    }
+
+    if (clear) Clear();
+}
+
+#else
+
+void event_trace::Report(comm_class &, bool const &)
+{
+    // Not built in ... empty report.
+}
+
+#endif
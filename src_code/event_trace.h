@@ -0,0 +1,93 @@
+#ifndef _EVENT_TRACE_H_
+#define _EVENT_TRACE_H_
+
+/****************************************************
+    Event Trace
+
+    File:   event_trace.h
+    Author: agent
+    agent AT local
+
+    event_trace.h file is part of the RGB LED Controller and Node 
+     version 1 hardware project.
+
+    This file contains the optional event pipeline latency tracing
+     (EVENT_TRACE=1 in the Makefile).
+    - Every event is stamped with the Timer0 timebase when it enters
+       the EventQueue (see timebase_class.h).
+    - The main loop records the event once the RGB Controller state
+       machine has processed it.
+    - Per E_InputHardware: a log2 histogram of the enqueue to
+       process() completion latency, the worst queue residency
+       (enqueue to dequeue) and the worst total latency.
+    The tables are sent with the E_REPORT_EVENT_LATENCY report.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+
+*****************************************************/
+
+#include <avr/io.h>
+
+#ifndef _EVENT_LISTING_H_
+#include "event_listing.h"
+#endif
+
+#ifndef _TIMEBASE_CLASS_H_
+#include "timebase_class.h"
+#endif
+
+class comm_class;
+
+class event_trace
+{
+public:
+    // Bucket N counts latencies of N significant bits (ie 2^(N-1) to
+    //  2^N - 1 ticks).  The last bucket collects everything longer.
+    static const uint8_t HISTOGRAM_BUCKETS = 16;
+
+    // Called by the main loop after process() returned
+    //  enqueued - timebase stamp taken by the EventQueue
+    //  dequeued - timebase stamp taken when the event left the queue
+    static void Record(E_InputHardware const &A
+                      ,uint16_t const &enqueued
+                      ,uint16_t const &dequeued);
+
+    /*
+        Report format (E_REPORT_EVENT_LATENCY):
+            TIMEBASE_PRESCALE log2 (1 byte) - cycles per tick = 1 << value
+            Number of buckets      (1 byte)
+            Per hardware with at least one event:
+                Hardware (E_InputHardware)   (1 byte)
+                Max queue residency ticks    (2 bytes, little endian)
+                Max total latency ticks      (2 bytes, little endian)
+                Histogram counts (saturate at 255) (1 byte per bucket)
+    */
+    static void Report(comm_class &aComm, bool const &clear);
+
+private:
+    static void Clear();
+
+    static uint8_t _Histogram[E_LAST_HARDWARE_EVENT][HISTOGRAM_BUCKETS];
+    static uint16_t _MaxResidency[E_LAST_HARDWARE_EVENT];
+    static uint16_t _MaxLatency[E_LAST_HARDWARE_EVENT];
+};
+
+#endif
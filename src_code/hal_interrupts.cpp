@@ -29,6 +29,24 @@
      When         Who                Description of change
     -----------  ----------         ------------------------
     2014 Sep 24  James Stokebrand   Initial creation.
+    2026 Oct 17  agent              Pin change observers deferred to
+                                      the main loop.
+    2026 Oct 17  agent              STATIC_OBSERVERS binds the pin
+                                      change and Timer2 observers
+                                      at compile time.
+    2026 Oct 17  agent              Edge scheduled PWM engine.
+    2026 Oct 17  agent              Port grouped PWM engine.
+    2026 Oct 17  agent              Bit angle modulation PWM engine.
+    2026 Oct 17  agent              Dithered duty values.
+    2026 Oct 17  agent              Fades step at the frame start.
+    2026 Oct 17  agent              SetPin ignores registers other
+                                      than the ports.
+    2026 Oct 17  agent              Fades and edge tables run after
+                                      the compare is set, with
+                                      interrupts enabled.
+    2026 Oct 17  agent              BAM on ck/256, late periods
+                                      caught up, bit tables built
+                                      with interrupts enabled.
 
 *****************************************************/
 
@@ -39,49 +57,116 @@
 #include "hal_interrupts.h"
 #endif
 
+#ifndef _ISR_PROFILE_H_
+#include "isr_profile.h"
+#endif
+
+#ifndef _POWER_STATS_H_
+#include "power_stats.h"
+#endif
+
+#ifndef _DEFERRED_WORK_H_
+#include "deferred_work.h"
+#endif
+
+#ifndef _PWM_FADE_CLASS_H_
+#include "pwm_fade_class.h"
+#endif
+
+#if STATIC_OBSERVERS
+// Update() of every observer type is inlined into the Notify()s below
+#ifndef _BUTTON_CLASS_H_
+#include "button_class.h"
+#endif
+
+#ifndef _ROTARY_ENCODER_CLASS_H_
+#include "rotary_encoder_class.h"
+#endif
+
+#ifndef _PWM_CLASS_H_
+#include "pwm_class.h"
+#endif
+
+template class StaticSubjectPinIntr<ButtonClass, RotaryEncoderClass>;
+template class StaticSubjectPWM<pwm_class>;
+#endif
+
 
 // PortB
 PORTB_interrupt_subject* PORTB_interrupt_subject::pINTR_handler = 0;
 
+// Runs the observers of the port (deferred from the ISR)
+static void PORTB_pin_change(uint8_t const &Pins)
+{
+    PORTB_interrupt_subject::pINTR_handler->PinIntrSubject::Notify(Pins);
+}
+
 PORTB_interrupt_subject::PORTB_interrupt_subject()
-: InterruptSubjectPinIntr(&PCMSK0,PCIE0)
+: PinIntrSubject(&PCMSK0,PCIE0,&PINB)
 {
     pINTR_handler = this;
+    deferred_work::Register(deferred_work::E_WORK_PCINT0, &PORTB_pin_change);
 }
 
 ISR(PCINT0_vect)
 {
-    PORTB_interrupt_subject::pINTR_handler->Notify();
+    POWER_STATS_WAKE(E_ISR_PCINT0);
+    ISR_PROFILE_ENTER();
+    // Snapshot the pins now, the observers may run much later
+    deferred_work::Post(deferred_work::E_WORK_PCINT0, PINB);
+    ISR_PROFILE_EXIT(E_ISR_PCINT0);
 }
 
 
 // PortC
 PORTC_interrupt_subject* PORTC_interrupt_subject::pINTR_handler = 0;
 
+// Runs the observers of the port (deferred from the ISR)
+static void PORTC_pin_change(uint8_t const &Pins)
+{
+    PORTC_interrupt_subject::pINTR_handler->PinIntrSubject::Notify(Pins);
+}
+
 PORTC_interrupt_subject::PORTC_interrupt_subject()
-: InterruptSubjectPinIntr(&PCMSK1,PCIE1)
+: PinIntrSubject(&PCMSK1,PCIE1,&PINC)
 {
     pINTR_handler = this;
+    deferred_work::Register(deferred_work::E_WORK_PCINT1, &PORTC_pin_change);
 }
 
 ISR(PCINT1_vect)
 {
-    PORTC_interrupt_subject::pINTR_handler->Notify();
+    POWER_STATS_WAKE(E_ISR_PCINT1);
+    ISR_PROFILE_ENTER();
+    // Snapshot the pins now, the observers may run much later
+    deferred_work::Post(deferred_work::E_WORK_PCINT1, PINC);
+    ISR_PROFILE_EXIT(E_ISR_PCINT1);
 }
 
 
 // PortD
 PORTD_interrupt_subject* PORTD_interrupt_subject::pINTR_handler = 0;
 
+// Runs the observers of the port (deferred from the ISR)
+static void PORTD_pin_change(uint8_t const &Pins)
+{
+    PORTD_interrupt_subject::pINTR_handler->PinIntrSubject::Notify(Pins);
+}
+
 PORTD_interrupt_subject::PORTD_interrupt_subject()
-: InterruptSubjectPinIntr(&PCMSK2,PCIE2)
+: PinIntrSubject(&PCMSK2,PCIE2,&PIND)
 {
     pINTR_handler = this;
+    deferred_work::Register(deferred_work::E_WORK_PCINT2, &PORTD_pin_change);
 }
 
 ISR(PCINT2_vect)
 {
-    PORTD_interrupt_subject::pINTR_handler->Notify();
+    POWER_STATS_WAKE(E_ISR_PCINT2);
+    ISR_PROFILE_ENTER();
+    // Snapshot the pins now, the observers may run much later
+    deferred_work::Post(deferred_work::E_WORK_PCINT2, PIND);
+    ISR_PROFILE_EXIT(E_ISR_PCINT2);
 }
 
 // Define the Port subjects for pin interrupts
@@ -90,7 +175,7 @@ PORTC_interrupt_subject aPortC_Inter;
 PORTD_interrupt_subject aPortD_Inter;
 
 // HAL lookup for the appropriate interrupt subject
-InterruptSubjectPinIntr *lookup_port_interrupt_subject::return_port_interrupt_subject(IOPinDefines::E_PinDef const &A)
+PinIntrSubject *lookup_port_interrupt_subject::return_port_interrupt_subject(IOPinDefines::E_PinDef const &A)
 {
     switch (A)
     {
@@ -142,11 +227,447 @@ InterruptSubjectPinIntr *lookup_port_interrupt_subject::return_port_interrupt_su
 // Timer2
 TIMER2_interrupt_subject* TIMER2_interrupt_subject::pINTR_handler = 0;
 
-#define PWM_FREQ 60UL
-#define PWM_OCR (F_CPU/(PWM_FREQ*8UL*256UL))
+// Running fades take their value of the coming frame
+static inline void pwm_fade_frame()
+{
+    if (pwm_fade_class::pFade) pwm_fade_class::pFade->Frame();
+}
+
+// The host clock stands still while the firmware runs, a host test
+//  charges the cycles of the frame work here
+#ifdef HAL_HOST
+#define PWM_FRAME_WORK_BUSY() hal_host_busy(HAL_HOST_BUSY_PWM_FRAME)
+#else
+#define PWM_FRAME_WORK_BUSY()
+#endif
+
+// The host takes an interrupt the cycle its flag is raised, a host
+//  test charges the latency of the compare ISR here (other ISRs and
+//  critical sections ahead of it)
+#ifdef HAL_HOST
+#define PWM_EDGE_LATENCY_BUSY() hal_host_busy(HAL_HOST_BUSY_PWM_LATENCY)
+#else
+#define PWM_EDGE_LATENCY_BUSY()
+#endif
+
+#if PWM_ENGINE != PWM_ENGINE_TICK
+#define PWM_DITHER_MASK ((1U << PWM_DITHER_BITS) - 1)
+
+// 8 bit duty of slot ID for the coming frame
+inline uint8_t TIMER2_interrupt_subject::FrameDuty(uint8_t const &ID)
+{
+#if PWM_DITHER_BITS
+    // The fraction adds up over the frames, each carry makes the
+    //  frame one step longer
+    pwm_duty_t const duty = _Duty[ID];
+    uint8_t step = duty >> PWM_DITHER_BITS;
+
+    _Dither[ID] += duty & PWM_DITHER_MASK;
+    if (_Dither[ID] > PWM_DITHER_MASK)
+    {
+        _Dither[ID] &= PWM_DITHER_MASK;
+        if (step != 0xFF) step++;
+    }
+    return step;
+#else
+    return _Duty[ID];
+#endif
+}
+
+#if PWM_ENGINE == PWM_ENGINE_BAM
+// Timer2 free runs at ck/256.  The period of bit N is 2^N Timer2
+//  ticks, a frame is 255 ticks (122Hz at 8MHz).  The shortest period
+//  is 256 CPU cycles, longer than the usual latency of the ISR.  A
+//  later ISR catches up (see Edge()).
+#define PWM_BAM_BITS 8
+
+TIMER2_interrupt_subject::TIMER2_interrupt_subject()
+: PWMSubject(&TIMSK2,OCIE2A)
+, _Front(0)
+, _Ready(false)
+, _Building(false)
+, _Bit(0)
+{
+    for (uint8_t jj=0; jj<_NumberOfObservers; jj++)
+    {
+        _Duty[jj] = 0;
+        _Pin[jj] = 0;
+#if PWM_DITHER_BITS
+        _Dither[jj] = 0;
+#endif
+    }
+    for (uint8_t tt=0; tt<2; tt++)
+    {
+        for (uint8_t pp=0; pp<_NumberOfPorts; pp++) _PortMask[tt][pp] = 0;
+    }
+
+    TIFR2 = (1 << OCF2A);                 /* clear interrupt */
+    TCCR2B = (1 << CS22) | (1 << CS21);   /* start timer (ck/256) */
+    TCCR2A = 0;                           /* normal mode, free running */
+    OCR2A = 1;                            /* First frame starts here */
+
+    pINTR_handler = this;
+}
+
+void TIMER2_interrupt_subject::Schedule()
+{
+    // Port levels of each bit period in the table the ISR is not
+    //  running.  The ISR only stores them.
+    uint8_t (*const bit_bits)[_NumberOfPorts] = _BitBits[_Front ^ 1];
+    uint8_t mask[_NumberOfPorts] = { 0 };
+    uint8_t invert[_NumberOfPorts] = { 0 };
+
+    for (uint8_t jj=0; jj<_NumberOfObservers; jj++)
+    {
+        if (!Drives(jj)) continue;
+
+        uint8_t const port = (_Pin[jj] >> 4) & 0x03;
+        uint8_t const bit = (1 << (_Pin[jj] & 0x07));
+
+        mask[port] |= bit;
+        if (_Pin[jj] & PWM_PIN_ACTIVE_LOW) invert[port] |= bit;
+    }
+
+    for (uint8_t bb=0; bb<PWM_BAM_BITS; bb++)
+    {
+        for (uint8_t pp=0; pp<_NumberOfPorts; pp++) bit_bits[bb][pp] = invert[pp];
+    }
+
+    for (uint8_t jj=0; jj<_NumberOfObservers; jj++)
+    {
+        if (!Drives(jj)) continue;
+
+        uint8_t const port = (_Pin[jj] >> 4) & 0x03;
+        uint8_t const bit = (1 << (_Pin[jj] & 0x07));
+        uint8_t const duty = FrameDuty(jj);
+
+        for (uint8_t bb=0; bb<PWM_BAM_BITS; bb++)
+        {
+            if (duty & (1 << bb)) bit_bits[bb][port] ^= bit;
+        }
+    }
+
+    for (uint8_t pp=0; pp<_NumberOfPorts; pp++) _PortMask[_Front ^ 1][pp] = mask[pp];
+}
+
+#else
+// Timer2 free runs at ck/256.  A PWM step is PWM_STEP_COUNTS Timer2
+//  ticks, a frame is 256 steps.  One compare reaches at most
+//  PWM_MAX_STEPS ahead, a longer gap between edges takes an extra
+//  compare.
+#define PWM_MAX_STEPS (256U/PWM_STEP_COUNTS)
+#define PWM_FRAME_STEPS 256U
+
+static_assert(PWM_STEP_COUNTS >= 1, "F_CPU is too slow for the scheduled PWM engines");
 
 TIMER2_interrupt_subject::TIMER2_interrupt_subject()
-: InterruptSubjectPWM(&TIMSK2,OCIE2A)
+: PWMSubject(&TIMSK2,OCIE2A)
+, _Front(0)
+, _Ready(false)
+, _Building(false)
+, _EdgeIndex(0)
+, _Step(0)
+{
+    for (uint8_t jj=0; jj<_NumberOfObservers; jj++)
+    {
+        _Duty[jj] = 0;
+#if PWM_DITHER_BITS
+        _Dither[jj] = 0;
+#endif
+    }
+
+    for (uint8_t tt=0; tt<2; tt++)
+    {
+        _EdgeCount[tt] = 0;
+#if PWM_ENGINE == PWM_ENGINE_EDGE
+        _StartMask[tt] = 0;
+#else
+        for (uint8_t pp=0; pp<_NumberOfPorts; pp++) _PortMask[tt][pp] = 0;
+#endif
+    }
+
+#if PWM_ENGINE == PWM_ENGINE_PORT
+    for (uint8_t jj=0; jj<_NumberOfObservers; jj++) _Pin[jj] = 0;
+#endif
+
+    TIFR2 = (1 << OCF2A);                 /* clear interrupt */
+    TCCR2B = (1 << CS22) | (1 << CS21);   /* start timer (ck/256) */
+    TCCR2A = 0;                           /* normal mode, free running */
+    OCR2A = PWM_STEP_COUNTS;              /* First frame starts here */
+
+    pINTR_handler = this;
+}
+
+// Fills the table the ISR does not run
+void TIMER2_interrupt_subject::Schedule()
+{
+    uint8_t const tt = _Front ^ 1;
+    uint8_t * const edge_step = _EdgeStep[tt];
+    uint8_t * const edge_mask = _EdgeMask[tt];
+    uint8_t edge_count = 0;
+    uint8_t duty[_NumberOfObservers];
+
+    for (uint8_t jj=0; jj<_NumberOfObservers; jj++)
+    {
+        duty[jj] = FrameDuty(jj);
+        if ((_Observer[jj] == nullptr) || (duty[jj] == 0)) continue;
+
+        // Insertion sort, there are only a few observers
+        uint8_t ii = 0;
+        while ((ii < edge_count) && (edge_step[ii] < duty[jj])) ii++;
+
+        if ((ii < edge_count) && (edge_step[ii] == duty[jj]))
+        {
+            // Shares the edge
+            edge_mask[ii] |= (1 << jj);
+        }
+        else
+        {
+            for (uint8_t kk=edge_count; kk>ii; kk--)
+            {
+                edge_step[kk] = edge_step[kk-1];
+                edge_mask[kk] = edge_mask[kk-1];
+            }
+            edge_step[ii] = duty[jj];
+            edge_mask[ii] = (1 << jj);
+            edge_count++;
+        }
+    }
+
+    _EdgeCount[tt] = edge_count;
+
+#if PWM_ENGINE == PWM_ENGINE_EDGE
+    uint8_t start = 0;
+    for (uint8_t ee=0; ee<edge_count; ee++) start |= edge_mask[ee];
+    _StartMask[tt] = start;
+#endif
+
+#if PWM_ENGINE == PWM_ENGINE_PORT
+    // Port levels of the frame start and after each edge.  The ISR
+    //  only stores them.
+    uint8_t mask[_NumberOfPorts] = { 0 };
+    uint8_t invert[_NumberOfPorts] = { 0 };
+    uint8_t lit[_NumberOfPorts] = { 0 };
+
+    for (uint8_t jj=0; jj<_NumberOfObservers; jj++)
+    {
+        if (!Drives(jj)) continue;
+
+        uint8_t const port = (_Pin[jj] >> 4) & 0x03;
+        uint8_t const bit = (1 << (_Pin[jj] & 0x07));
+
+        mask[port] |= bit;
+        if (_Pin[jj] & PWM_PIN_ACTIVE_LOW) invert[port] |= bit;
+        if (duty[jj]) lit[port] |= bit;
+    }
+
+    for (uint8_t pp=0; pp<_NumberOfPorts; pp++)
+    {
+        _PortMask[tt][pp] = mask[pp];
+        _StartBits[tt][pp] = lit[pp] ^ invert[pp];
+    }
+
+    for (uint8_t ee=0; ee<edge_count; ee++)
+    {
+        for (uint8_t jj=0; jj<_NumberOfObservers; jj++)
+        {
+            if ((edge_mask[ee] & (1 << jj)) && Drives(jj))
+            {
+                lit[(_Pin[jj] >> 4) & 0x03] &= ~(1 << (_Pin[jj] & 0x07));
+            }
+        }
+
+        for (uint8_t pp=0; pp<_NumberOfPorts; pp++)
+        {
+            _EdgeBits[tt][ee][pp] = lit[pp] ^ invert[pp];
+        }
+    }
+#endif
+}
+
+#endif
+
+#if (PWM_ENGINE == PWM_ENGINE_PORT) || (PWM_ENGINE == PWM_ENGINE_BAM)
+void TIMER2_interrupt_subject::SetPin(uint8_t const &ID
+                                     ,volatile uint8_t* const &PortReg
+                                     ,uint8_t const &Bit
+                                     ,bool const &ActiveLow)
+{
+    if (ID >= _NumberOfObservers) return;
+
+    uint8_t port;
+    if (PortReg == &PORTB) port = 0;
+    else if (PortReg == &PORTC) port = 1;
+    else if (PortReg == &PORTD) port = 2;
+    else
+    {
+        // Not a port the engine drives, the slot keeps its duty but
+        //  no pin follows it
+        _Pin[ID] = PWM_PIN_NONE;
+        return;
+    }
+
+    _Pin[ID] = (port << 4) | (Bit & 0x07) | (ActiveLow ? PWM_PIN_ACTIVE_LOW : 0);
+}
+
+void TIMER2_interrupt_subject::Detach(uint8_t const &ID)
+{
+    if (ID >= _NumberOfObservers) return;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        // Stop driving the pin before the frame ends, the caller
+        //  sets its level next
+        if (Drives(ID))
+        {
+            uint8_t const port = (_Pin[ID] >> 4) & 0x03;
+            uint8_t const bit = (1 << (_Pin[ID] & 0x07));
+            // Also the table built for the next frame
+            _PortMask[0][port] &= ~bit;
+            _PortMask[1][port] &= ~bit;
+        }
+        PWMSubject::Detach(ID);
+    }
+}
+
+// One store for the PWM bits of a port, the other bits are kept
+static inline void pwm_port_store(volatile uint8_t &Port
+                                 ,uint8_t const Mask
+                                 ,uint8_t const Bits)
+{
+    if (Mask) Port = (Port & ~Mask) | (Bits & Mask);
+}
+
+static inline void pwm_ports_store(volatile uint8_t const *Mask, uint8_t const *Bits)
+{
+    pwm_port_store(PORTB, Mask[0], Bits[0]);
+    pwm_port_store(PORTC, Mask[1], Bits[1]);
+    pwm_port_store(PORTD, Mask[2], Bits[2]);
+}
+#endif
+
+#if PWM_ENGINE == PWM_ENGINE_BAM
+void TIMER2_interrupt_subject::Edge()
+{
+    uint8_t bit = _Bit;
+    bool frame_end = false;
+
+    // Start of the period, the compare that raised the interrupt
+    uint8_t start = OCR2A;
+
+    for (;;)
+    {
+        // Frame start.  Takes the table built during the last frame,
+        //  the old one runs again while a build is unfinished.
+        if ((bit == 0) && _Ready)
+        {
+            _Front ^= 1;
+            _Ready = false;
+        }
+
+        // End of this period, relative to the last compare
+        uint8_t const period = (1 << bit);
+        OCR2A = start + period;
+
+        pwm_ports_store(_PortMask[_Front], _BitBits[_Front][bit]);
+
+        if (bit == (PWM_BAM_BITS - 1)) frame_end = true;
+        bit = (bit + 1) & (PWM_BAM_BITS - 1);
+
+        // The compare is still ahead of the timer.  Otherwise a late
+        //  ISR found the period over, the compare would only match
+        //  after a Timer2 wrap.  The next period starts now, the one
+        //  missed is cut short and the frame keeps its length.
+        if ((uint8_t)(TCNT2 - start) < period) break;
+        start += period;
+    }
+    _Bit = bit;
+
+    // The longest period takes the duty values of the next frame.
+    //  The next compare is set, the work runs with interrupts on.
+    if (frame_end && !_Building) Build();
+}
+
+#else
+void TIMER2_interrupt_subject::Edge()
+{
+    bool const frame_start = (_Step == 0);
+
+    if (frame_start)
+    {
+        // Frame start.  Takes the table built during the last frame,
+        //  the old one runs again while a build is unfinished.
+        if (_Ready)
+        {
+            _Front ^= 1;
+            _Ready = false;
+        }
+        _EdgeIndex = 0;
+#if PWM_ENGINE == PWM_ENGINE_PORT
+        pwm_ports_store(_PortMask[_Front], _StartBits[_Front]);
+#else
+        // Update(0) turns on every observer with a duty in this
+        //  frame, Update(0xFF) turns off the ones dithered to zero
+        PWMSubject::NotifyMask(0, _StartMask[_Front]);
+        PWMSubject::NotifyMask(0xFF, ((1 << _NumberOfObservers) - 1) & ~_StartMask[_Front]);
+#endif
+    }
+    else if ((_EdgeIndex < _EdgeCount[_Front]) && (_EdgeStep[_Front][_EdgeIndex] == _Step))
+    {
+#if PWM_ENGINE == PWM_ENGINE_PORT
+        pwm_ports_store(_PortMask[_Front], _EdgeBits[_Front][_EdgeIndex]);
+#else
+        // Update(0xFF) turns off any duty
+        PWMSubject::NotifyMask(0xFF, _EdgeMask[_Front][_EdgeIndex]);
+#endif
+        _EdgeIndex++;
+    }
+    // ELSE passing through a long gap
+
+    // Steps to the next edge or the end of the frame
+    uint16_t const next = (_EdgeIndex < _EdgeCount[_Front]) ? _EdgeStep[_Front][_EdgeIndex] : PWM_FRAME_STEPS;
+    uint16_t gap = next - _Step;
+    if (gap > PWM_MAX_STEPS) gap = PWM_MAX_STEPS;
+
+    // Relative to the last compare, the ISR latency does not add up
+    OCR2A += (uint8_t)(gap * PWM_STEP_COUNTS);
+
+    _Step += gap;
+    if (_Step == PWM_FRAME_STEPS) _Step = 0;
+
+    // The next compare is set, the rest of the frame start can wait
+    if (frame_start && !_Building) Build();
+}
+#endif
+
+// Fades and the table of the next frame.  Takes longer than a PWM
+//  step, the edges that come due meanwhile nest in this ISR.
+void TIMER2_interrupt_subject::Build()
+{
+    _Building = true;
+    sei();
+
+    pwm_fade_frame();
+    Schedule();
+    PWM_FRAME_WORK_BUSY();
+
+    cli();
+    _Ready = true;
+    _Building = false;
+}
+
+ISR(TIMER2_COMPA_vect)
+{
+    ISR_PROFILE_TIMER2_LATENCY(TCNT2);
+    POWER_STATS_WAKE(E_ISR_TIMER2_COMPA);
+    ISR_PROFILE_ENTER();
+    PWM_EDGE_LATENCY_BUSY();
+    TIMER2_interrupt_subject::pINTR_handler->Edge();
+    ISR_PROFILE_EXIT(E_ISR_TIMER2_COMPA);
+}
+
+#else
+TIMER2_interrupt_subject::TIMER2_interrupt_subject()
+: PWMSubject(&TIMSK2,OCIE2A)
 , pwmCount(0)
 {
 
@@ -160,9 +681,27 @@ TIMER2_interrupt_subject::TIMER2_interrupt_subject()
 
 ISR(TIMER2_COMPA_vect)
 {
-    TIMER2_interrupt_subject::pINTR_handler->Notify(
-            TIMER2_interrupt_subject::pINTR_handler->pwmCount++);
+    ISR_PROFILE_TIMER2_LATENCY(TCNT2);
+    POWER_STATS_WAKE(E_ISR_TIMER2_COMPA);
+    ISR_PROFILE_ENTER();
+    uint8_t const count = TIMER2_interrupt_subject::pINTR_handler->pwmCount++;
+    TIMER2_interrupt_subject::pINTR_handler->PWMSubject::Notify(count);
+
+    // Frame start.  The fades take several ticks, they run after the
+    //  pins are set with the ticks that come due nested.
+    static bool fading = false;
+    if ((count == 0) && !fading)
+    {
+        fading = true;
+        sei();
+        pwm_fade_frame();
+        PWM_FRAME_WORK_BUSY();
+        cli();
+        fading = false;
+    }
+    ISR_PROFILE_EXIT(E_ISR_TIMER2_COMPA);
 }
+#endif
 
 // SPI
 SPI_interrupt_subject* SPI_interrupt_subject::pINTR_handler = 0;
@@ -173,9 +712,12 @@ SPI_interrupt_subject::SPI_interrupt_subject() {
 
 ISR(SPI_STC_vect)
 {
+    POWER_STATS_WAKE(E_ISR_SPI_STC);
+    ISR_PROFILE_ENTER();
     // Notify the observer of the Spi Data Register's contents
     uint8_t temp = SPDR;
     SPI_interrupt_subject::pINTR_handler->Notify(temp);
+    ISR_PROFILE_EXIT(E_ISR_SPI_STC);
 }
 
 // TWI
@@ -187,8 +729,11 @@ TWI_interrupt_subject::TWI_interrupt_subject() {
 
 ISR(TWI_vect)
 {
+    POWER_STATS_WAKE(E_ISR_TWI);
+    ISR_PROFILE_ENTER();
     // Notify the observer of the TWI Status Register's contents
     TWI_interrupt_subject::pINTR_handler->Notify();
+    ISR_PROFILE_EXIT(E_ISR_TWI);
 }
 
 
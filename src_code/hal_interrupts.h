@@ -32,6 +32,20 @@
      When         Who                Description of change
     -----------  ----------         ------------------------
     2014 Sep 24  James Stokebrand   Initial creation.
+    2026 Oct 17  agent              STATIC_OBSERVERS binds the pin
+                                      change and Timer2 observers
+                                      at compile time.
+    2026 Oct 17  agent              Edge scheduled PWM engine.
+    2026 Oct 17  agent              Port grouped PWM engine.
+    2026 Oct 17  agent              Bit angle modulation PWM engine.
+    2026 Oct 17  agent              Dithered duty values.
+    2026 Oct 17  agent              PWM frame length for the fade
+                                      engine.
+    2026 Oct 17  agent              Edge tables built for the next
+                                      frame after the compare is set.
+    2026 Oct 17  agent              BAM on ck/256, late periods
+                                      caught up, bit tables built
+                                      with interrupts enabled.
 
 *****************************************************/
 
@@ -44,9 +58,80 @@
 #include "pin_class.h"
 #endif
 
+// Software PWM engines on Timer2 (PWM_ENGINE in the Makefile)
+//  PWM_ENGINE_TICK: 256 compare interrupts per frame, every observer
+//                   compares its duty with the tick count
+//  PWM_ENGINE_EDGE: the duty values are sorted once per frame and
+//                   OCR2A is moved to the next edge, Timer2 interrupts
+//                   only when a pin changes
+//  PWM_ENGINE_PORT: scheduled like PWM_ENGINE_EDGE, the levels of every
+//                   edge are precomputed per port.  An edge is one store
+//                   per port, the observers are not called.
+//  PWM_ENGINE_BAM:  bit angle modulation.  The frame is 8 periods of
+//                   1, 2, 4 .. 128 Timer2 ticks, a pin is lit in the
+//                   periods of the bits set in its duty.  8 interrupts
+//                   per frame for any duty values, stored per port like
+//                   PWM_ENGINE_PORT.
+#define PWM_ENGINE_TICK 0
+#define PWM_ENGINE_EDGE 1
+#define PWM_ENGINE_PORT 2
+#define PWM_ENGINE_BAM  3
+
+#define PWM_FREQ 60UL
+#define PWM_OCR (F_CPU/(PWM_FREQ*8UL*256UL))
+#define PWM_STEP_COUNTS (F_CPU/(PWM_FREQ*256UL*256UL))
+
+// CPU cycles of a PWM frame (the fade engine steps once per frame)
+#if PWM_ENGINE == PWM_ENGINE_TICK
+#define PWM_FRAME_CYCLES (8UL*(PWM_OCR+1)*256UL)
+#elif PWM_ENGINE == PWM_ENGINE_BAM
+#define PWM_FRAME_CYCLES (256UL*255UL)
+#else
+#define PWM_FRAME_CYCLES (PWM_STEP_COUNTS*256UL*256UL)
+#endif
+
+// Temporal dithering (PWM_DITHER_BITS in the Makefile).  A duty value
+//  carries PWM_DITHER_BITS of fraction below the 8 bit step, the
+//  scheduled engines spread it over the frames (sigma-delta).
+//  The tick engine compares the linear 8 bit value of the observers,
+//  it has neither the dithering nor the gamma table of pwm_class.
+#ifndef PWM_DITHER_BITS
+#define PWM_DITHER_BITS 0
+#endif
+
+#if PWM_ENGINE == PWM_ENGINE_TICK
+#undef PWM_DITHER_BITS
+#define PWM_DITHER_BITS 0
+#undef PWM_GAMMA
+#define PWM_GAMMA 0
+#endif
+
+#if PWM_DITHER_BITS
+typedef uint16_t pwm_duty_t;
+#else
+typedef uint8_t pwm_duty_t;
+#endif
+
+#if STATIC_OBSERVERS
+// Every observer type of the pin change and Timer2 vectors
+class ButtonClass;
+class RotaryEncoderClass;
+class pwm_class;
+
+typedef StaticSubjectPinIntr<ButtonClass, RotaryEncoderClass> PinIntrSubject;
+typedef StaticSubjectPWM<pwm_class> PWMSubject;
+
+// Instantiated in hal_interrupts.cpp
+extern template class StaticSubjectPinIntr<ButtonClass, RotaryEncoderClass>;
+extern template class StaticSubjectPWM<pwm_class>;
+#else
+typedef InterruptSubjectPinIntr PinIntrSubject;
+typedef InterruptSubjectPWM PWMSubject;
+#endif
+
 // Interrupt handler for PortB input pins (IE buttons, rotary encoders etc)
 class PORTB_interrupt_subject
-: public InterruptSubjectPinIntr
+: public PinIntrSubject
 {
 public:
     PORTB_interrupt_subject();
@@ -57,7 +142,7 @@ private:
 
 // Interrupt handler for PortC input pins (IE buttons, rotary encoders etc)
 class PORTC_interrupt_subject
-: public InterruptSubjectPinIntr
+: public PinIntrSubject
 {
 public:
     PORTC_interrupt_subject();
@@ -68,7 +153,7 @@ private:
 
 // Interrupt handler for PortD input pins (IE buttons, rotary encoders etc)
 class PORTD_interrupt_subject
-: public InterruptSubjectPinIntr
+: public PinIntrSubject
 {
 public:
     PORTD_interrupt_subject();
@@ -84,18 +169,114 @@ public:
     lookup_port_interrupt_subject() { }
     virtual ~lookup_port_interrupt_subject() { } 
 
-    static InterruptSubjectPinIntr *return_port_interrupt_subject(IOPinDefines::E_PinDef const &A);
+    static PinIntrSubject *return_port_interrupt_subject(IOPinDefines::E_PinDef const &A);
 };
 
 class TIMER2_interrupt_subject
-: public InterruptSubjectPWM
+: public PWMSubject
 {
 public:
     TIMER2_interrupt_subject();
     virtual ~TIMER2_interrupt_subject() {}
     static TIMER2_interrupt_subject* pINTR_handler;
+#if PWM_ENGINE != PWM_ENGINE_TICK
+    // Duty of the observer in slot ID.  Taken at the next frame start
+    //  and shown in the frame after it (EDGE/PORT).
+    void SetDuty(uint8_t const &ID, pwm_duty_t const &A)
+    {
+        if (ID < _NumberOfObservers) _Duty[ID] = A;
+    }
+
+#if (PWM_ENGINE == PWM_ENGINE_PORT) || (PWM_ENGINE == PWM_ENGINE_BAM)
+    // Output pin of the observer in slot ID.  ActiveLow for LEDs tied
+    //  to V+ (common anode).
+    void SetPin(uint8_t const &ID
+               ,volatile uint8_t* const &PortReg
+               ,uint8_t const &Bit
+               ,bool const &ActiveLow);
+
+    // The pin of the slot is released at once
+    void Detach(uint8_t const &ID);
+#endif
+
+    // Serves the Timer2 compare match (frame start or edge)
+    void Edge();
+
+private:
+    void Schedule();
+    void Build();
+    uint8_t FrameDuty(uint8_t const &ID);
+
+    pwm_duty_t _Duty[_NumberOfObservers];
+
+#if PWM_DITHER_BITS
+    // Fraction carried over to the next frame
+    uint8_t _Dither[_NumberOfObservers];
+#endif
+
+    // Two tables of each kind: the ISR runs the frame of table
+    //  _Front while Build() fills the other one for the next frame.
+    uint8_t _Front;
+
+    // The other table is built, the next frame start takes it
+    bool _Ready;
+
+    // Build() runs, with interrupts enabled
+    bool _Building;
+
+#if PWM_ENGINE != PWM_ENGINE_BAM
+    // Off edges of a frame in ascending order.  The observers with
+    //  the same duty share an edge (mask of slots).
+    uint8_t _EdgeStep[2][_NumberOfObservers];
+    uint8_t _EdgeMask[2][_NumberOfObservers];
+    uint8_t _EdgeCount[2];
+    uint8_t _EdgeIndex;
+
+#if PWM_ENGINE == PWM_ENGINE_EDGE
+    // Slots lit at the frame start
+    uint8_t _StartMask[2];
+#endif
+
+    // Frame position (PWM steps) of the next compare match
+    uint16_t _Step;
+#else
+    // Bit of the duty values shown in the current period
+    uint8_t _Bit;
+#endif
+
+#if (PWM_ENGINE == PWM_ENGINE_PORT) || (PWM_ENGINE == PWM_ENGINE_BAM)
+    // Ports the engine drives (PORTB, PORTC, PORTD)
+    static const uint8_t _NumberOfPorts = 3;
+
+    // Pin of each slot: port << 4 | bit, PWM_PIN_ACTIVE_LOW.
+    //  PWM_PIN_NONE when SetPin() was given a register that is not
+    //  one of the ports.
+    static const uint8_t PWM_PIN_ACTIVE_LOW = 0x80;
+    static const uint8_t PWM_PIN_NONE = 0x30;
+    uint8_t _Pin[_NumberOfObservers];
+
+    // Slot attached and driving a pin
+    bool Drives(uint8_t const &ID) const
+    {
+        return (_Observer[ID] != nullptr) && (_Pin[ID] != PWM_PIN_NONE);
+    }
+
+    // Port bits driven by each table, a detached slot leaves at once
+    volatile uint8_t _PortMask[2][_NumberOfPorts];
+
+#if PWM_ENGINE == PWM_ENGINE_BAM
+    // Port levels of each bit period
+    uint8_t _BitBits[2][8][_NumberOfPorts];
+#else
+    // Port levels from the frame start and after each edge
+    uint8_t _StartBits[2][_NumberOfPorts];
+    uint8_t _EdgeBits[2][_NumberOfObservers][_NumberOfPorts];
+#endif
+#endif
+#else
     volatile uint8_t pwmCount;
 private:
+#endif
 };
 
 class SPI_interrupt_subject
@@ -0,0 +1,79 @@
+#ifndef _HAL_HOST_AVR_INTERRUPT_H_
+#define _HAL_HOST_AVR_INTERRUPT_H_
+
+/****************************************************
+    Host HAL - AVR interrupt shim
+
+    File:   host/avr/interrupt.h
+    Author: agent
+    agent AT local
+
+    host/avr/interrupt.h file is part of the RGB LED Controller and Node
+     version 1 hardware project.
+
+    This file stands in for the avr-libc <avr/interrupt.h> when the
+     firmware is built for a Linux host.  sei()/cli() update the I bit
+     of the simulated SREG and ISR() defines a plain C function that
+     hal_host.cpp dispatches as if it were the hardware vector.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+    2026 Oct 17  agent              hal_host_busy().
+    2026 Oct 17  agent              Timer2 latency busy site.
+
+*****************************************************/
+
+#include <avr/io.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void hal_host_sei(void);
+void hal_host_cli(void);
+
+// Dispatches the interrupts due, accesses of UCSR0A call it (avr/io.h)
+void hal_host_poll(void);
+
+// Charges the cycles a host test set for the site (hal_host::SetBusy)
+//  to the simulated clock.  0 unless a test sets it.
+#define HAL_HOST_BUSY_PWM_FRAME   0 // Fades and PWM tables of a frame
+#define HAL_HOST_BUSY_PWM_LATENCY 1 // Timer2 compare ISR kept waiting
+#define HAL_HOST_BUSY_SITES       2
+void hal_host_busy(unsigned char aSite);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define sei() hal_host_sei()
+#define cli() hal_host_cli()
+
+#ifdef __cplusplus
+#define ISR(vector, ...) \
+    extern "C" void vector(void); \
+    extern "C" void vector(void)
+#else
+#define ISR(vector, ...) \
+    void vector(void); \
+    void vector(void)
+#endif
+
+#endif
@@ -0,0 +1,390 @@
+#ifndef _HAL_HOST_AVR_IO_H_
+#define _HAL_HOST_AVR_IO_H_
+
+/****************************************************
+    Host HAL - AVR I/O register shim
+
+    File:   host/avr/io.h
+    Author: agent
+    agent AT local
+
+    host/avr/io.h file is part of the RGB LED Controller and Node
+     version 1 hardware project.
+
+    This file stands in for the avr-libc <avr/io.h> when the firmware
+     is built for a Linux host (see "make host").  Every ATmega328p
+     register used by the firmware is mapped onto a simulated register
+     file at its real data space address.  The simulated registers are
+     driven by hal_host.cpp.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+    2026 Oct 17  agent              Vector numbers.
+    2026 Oct 17  agent              UCSR0A accesses run the interrupts
+                                      due.
+
+*****************************************************/
+
+#include <stdint.h>
+
+// Simulated data space (general purpose, I/O and extended I/O registers)
+#define HAL_HOST_IO_SIZE 0x100
+extern volatile uint8_t hal_host_io[HAL_HOST_IO_SIZE];
+
+#define _SFR_MEM8(mem_addr)  (hal_host_io[(mem_addr)])
+#define _SFR_MEM16(mem_addr) (*(volatile uint16_t *)&hal_host_io[(mem_addr)])
+#define _SFR_IO8(io_addr)    _SFR_MEM8((io_addr) + 0x20)
+
+#define _BV(bit) (1 << (bit))
+
+// Interrupt flag registers are "write one to clear" on the real part.
+//  A plain store into the register file would set the flags instead,
+//  so the firmware sees them through this proxy.  hal_host.cpp
+//  accesses the raw registers.
+#ifdef __cplusplus
+struct hal_host_flag_reg
+{
+    uint8_t _Addr;
+    operator uint8_t() const { return hal_host_io[_Addr]; }
+    hal_host_flag_reg const &operator=(uint8_t const aValue) const
+    {
+        hal_host_io[_Addr] &= ~aValue;
+        return *this;
+    }
+};
+#define _SFR_FLAG8(io_addr) (hal_host_flag_reg{ (uint8_t)((io_addr) + 0x20) })
+#else
+#define _SFR_FLAG8(io_addr) _SFR_IO8(io_addr)
+#endif
+
+// A firmware loop polling a status register gives the interrupts it
+//  waits for the cycles to run on the real part.  On the host every
+//  access of the register through this proxy dispatches them (when
+//  enabled), "(void)UCSR0A;" included.
+#ifdef __cplusplus
+extern "C" void hal_host_poll(void);
+
+struct hal_host_poll_reg
+{
+    uint8_t _Addr;
+    explicit hal_host_poll_reg(uint8_t const aAddr) : _Addr(aAddr) { hal_host_poll(); }
+    operator uint8_t() const { return hal_host_io[_Addr]; }
+    hal_host_poll_reg const &operator=(uint8_t const aValue) const
+    {
+        hal_host_io[_Addr] = aValue;
+        return *this;
+    }
+};
+#define _SFR_POLL8(mem_addr) (hal_host_poll_reg((uint8_t)(mem_addr)))
+#else
+#define _SFR_POLL8(mem_addr) _SFR_MEM8(mem_addr)
+#endif
+
+#define RAMSTART 0x100
+#define RAMEND   0x8FF
+
+// Ports
+#define PINB    _SFR_IO8(0x03)
+#define DDRB    _SFR_IO8(0x04)
+#define PORTB   _SFR_IO8(0x05)
+#define PINC    _SFR_IO8(0x06)
+#define DDRC    _SFR_IO8(0x07)
+#define PORTC   _SFR_IO8(0x08)
+#define PIND    _SFR_IO8(0x09)
+#define DDRD    _SFR_IO8(0x0A)
+#define PORTD   _SFR_IO8(0x0B)
+
+#define PB0 0
+#define PB1 1
+#define PB2 2
+#define PB3 3
+#define PB4 4
+#define PB5 5
+#define PB6 6
+#define PB7 7
+
+#define PC0 0
+#define PC1 1
+#define PC2 2
+#define PC3 3
+#define PC4 4
+#define PC5 5
+#define PC6 6
+
+#define PD0 0
+#define PD1 1
+#define PD2 2
+#define PD3 3
+#define PD4 4
+#define PD5 5
+#define PD6 6
+#define PD7 7
+
+// Interrupt flag registers
+#define TIFR0   _SFR_FLAG8(0x15)
+#define TOV0    0
+#define OCF0A   1
+#define OCF0B   2
+
+#define TIFR1   _SFR_FLAG8(0x16)
+#define TOV1    0
+#define OCF1A   1
+#define OCF1B   2
+#define ICF1    5
+
+#define TIFR2   _SFR_FLAG8(0x17)
+#define TOV2    0
+#define OCF2A   1
+#define OCF2B   2
+
+#define PCIFR   _SFR_FLAG8(0x1B)
+#define PCIF0   0
+#define PCIF1   1
+#define PCIF2   2
+
+#define EIFR    _SFR_FLAG8(0x1C)
+#define EIMSK   _SFR_IO8(0x1D)
+
+// Timer0
+#define GTCCR   _SFR_IO8(0x23)
+#define TCCR0A  _SFR_IO8(0x24)
+#define WGM00   0
+#define WGM01   1
+#define COM0B0  4
+#define COM0B1  5
+#define COM0A0  6
+#define COM0A1  7
+
+#define TCCR0B  _SFR_IO8(0x25)
+#define CS00    0
+#define CS01    1
+#define CS02    2
+#define WGM02   3
+
+#define TCNT0   _SFR_IO8(0x26)
+#define OCR0A   _SFR_IO8(0x27)
+#define OCR0B   _SFR_IO8(0x28)
+
+// SPI
+#define SPCR    _SFR_IO8(0x2C)
+#define SPSR    _SFR_IO8(0x2D)
+#define SPDR    _SFR_IO8(0x2E)
+
+// Sleep and MCU control
+#define SMCR    _SFR_IO8(0x33)
+#define SE      0
+#define SM0     1
+#define SM1     2
+#define SM2     3
+
+#define MCUSR   _SFR_IO8(0x34)
+#define MCUCR   _SFR_IO8(0x35)
+#define PUD     4
+#define BODSE   5
+#define BODS    6
+
+// Stack pointer and status register
+#define SPL     _SFR_IO8(0x3D)
+#define SPH     _SFR_IO8(0x3E)
+#define SP      _SFR_MEM16(0x5D)
+#define SREG    _SFR_IO8(0x3F)
+#define SREG_I  7
+
+// Power reduction
+#define PRR     _SFR_MEM8(0x64)
+#define PRADC    0
+#define PRUSART0 1
+#define PRSPI    2
+#define PRTIM1   3
+#define PRTIM0   5
+#define PRTIM2   6
+#define PRTWI    7
+
+// Pin change and external interrupts
+#define PCICR   _SFR_MEM8(0x68)
+#define PCIE0   0
+#define PCIE1   1
+#define PCIE2   2
+
+#define EICRA   _SFR_MEM8(0x69)
+#define ISC00   0
+#define ISC01   1
+#define ISC10   2
+#define ISC11   3
+
+#define PCMSK0  _SFR_MEM8(0x6B)
+#define PCMSK1  _SFR_MEM8(0x6C)
+#define PCMSK2  _SFR_MEM8(0x6D)
+
+// Timer interrupt masks
+#define TIMSK0  _SFR_MEM8(0x6E)
+#define TOIE0   0
+#define OCIE0A  1
+#define OCIE0B  2
+
+#define TIMSK1  _SFR_MEM8(0x6F)
+#define TOIE1   0
+#define OCIE1A  1
+#define OCIE1B  2
+#define ICIE1   5
+
+#define TIMSK2  _SFR_MEM8(0x70)
+#define TOIE2   0
+#define OCIE2A  1
+#define OCIE2B  2
+
+// Timer1
+#define TCCR1A  _SFR_MEM8(0x80)
+#define WGM10   0
+#define WGM11   1
+#define COM1B0  4
+#define COM1B1  5
+#define COM1A0  6
+#define COM1A1  7
+
+#define TCCR1B  _SFR_MEM8(0x81)
+#define CS10    0
+#define CS11    1
+#define CS12    2
+#define WGM12   3
+#define WGM13   4
+#define ICES1   6
+#define ICNC1   7
+
+#define TCCR1C  _SFR_MEM8(0x82)
+#define TCNT1   _SFR_MEM16(0x84)
+#define ICR1    _SFR_MEM16(0x86)
+#define OCR1A   _SFR_MEM16(0x88)
+#define OCR1B   _SFR_MEM16(0x8A)
+
+// Timer2
+#define TCCR2A  _SFR_MEM8(0xB0)
+#define WGM20   0
+#define WGM21   1
+#define COM2B0  4
+#define COM2B1  5
+#define COM2A0  6
+#define COM2A1  7
+
+#define TCCR2B  _SFR_MEM8(0xB1)
+#define CS20    0
+#define CS21    1
+#define CS22    2
+#define WGM22   3
+
+#define TCNT2   _SFR_MEM8(0xB2)
+#define OCR2A   _SFR_MEM8(0xB3)
+#define OCR2B   _SFR_MEM8(0xB4)
+#define ASSR    _SFR_MEM8(0xB6)
+
+// TWI
+#define TWBR    _SFR_MEM8(0xB8)
+#define TWSR    _SFR_MEM8(0xB9)
+#define TWAR    _SFR_MEM8(0xBA)
+#define TWDR    _SFR_MEM8(0xBB)
+#define TWCR    _SFR_MEM8(0xBC)
+
+// USART0
+#define UCSR0A  _SFR_POLL8(0xC0)
+#define MPCM0   0
+#define U2X0    1
+#define UPE0    2
+#define DOR0    3
+#define FE0     4
+#define UDRE0   5
+#define TXC0    6
+#define RXC0    7
+
+#define UCSR0B  _SFR_MEM8(0xC1)
+#define TXB80   0
+#define RXB80   1
+#define UCSZ02  2
+#define TXEN0   3
+#define RXEN0   4
+#define UDRIE0  5
+#define TXCIE0  6
+#define RXCIE0  7
+
+#define UCSR0C  _SFR_MEM8(0xC2)
+#define UCPOL0  0
+#define UCSZ00  1
+#define UCSZ01  2
+
+#define UBRR0L  _SFR_MEM8(0xC4)
+#define UBRR0H  _SFR_MEM8(0xC5)
+#define UDR0    _SFR_MEM8(0xC6)
+
+// Interrupt vectors (same numbering as the ATmega328p vector table)
+#define INT0_vect           __vector_1
+#define INT1_vect           __vector_2
+#define PCINT0_vect         __vector_3
+#define PCINT1_vect         __vector_4
+#define PCINT2_vect         __vector_5
+#define WDT_vect            __vector_6
+#define TIMER2_COMPA_vect   __vector_7
+#define TIMER2_COMPB_vect   __vector_8
+#define TIMER2_OVF_vect     __vector_9
+#define TIMER1_CAPT_vect    __vector_10
+#define TIMER1_COMPA_vect   __vector_11
+#define TIMER1_COMPB_vect   __vector_12
+#define TIMER1_OVF_vect     __vector_13
+#define TIMER0_COMPA_vect   __vector_14
+#define TIMER0_COMPB_vect   __vector_15
+#define TIMER0_OVF_vect     __vector_16
+#define SPI_STC_vect        __vector_17
+#define USART_RX_vect       __vector_18
+#define USART_UDRE_vect     __vector_19
+#define USART_TX_vect       __vector_20
+#define ADC_vect            __vector_21
+#define EE_READY_vect       __vector_22
+#define ANALOG_COMP_vect    __vector_23
+#define TWI_vect            __vector_24
+#define SPM_READY_vect      __vector_25
+
+// Vector numbers (avr-libc <name>_vect_num)
+#define INT0_vect_num         1
+#define INT1_vect_num         2
+#define PCINT0_vect_num       3
+#define PCINT1_vect_num       4
+#define PCINT2_vect_num       5
+#define WDT_vect_num          6
+#define TIMER2_COMPA_vect_num 7
+#define TIMER2_COMPB_vect_num 8
+#define TIMER2_OVF_vect_num   9
+#define TIMER1_CAPT_vect_num  10
+#define TIMER1_COMPA_vect_num 11
+#define TIMER1_COMPB_vect_num 12
+#define TIMER1_OVF_vect_num   13
+#define TIMER0_COMPA_vect_num 14
+#define TIMER0_COMPB_vect_num 15
+#define TIMER0_OVF_vect_num   16
+#define SPI_STC_vect_num      17
+#define USART_RX_vect_num     18
+#define USART_UDRE_vect_num   19
+#define USART_TX_vect_num     20
+#define ADC_vect_num          21
+#define EE_READY_vect_num     22
+#define ANALOG_COMP_vect_num  23
+#define TWI_vect_num          24
+#define SPM_READY_vect_num    25
+
+#define _VECTORS_SIZE 26
+
+#endif
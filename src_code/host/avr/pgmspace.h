@@ -0,0 +1,47 @@
+#ifndef _HAL_HOST_AVR_PGMSPACE_H_
+#define _HAL_HOST_AVR_PGMSPACE_H_
+
+/****************************************************
+    Host HAL - AVR program space shim
+
+    File:   host/avr/pgmspace.h
+    Author: agent
+    agent AT local
+
+    host/avr/pgmspace.h file is part of the RGB LED Controller and Node
+     version 1 hardware project.
+
+    This file stands in for the avr-libc <avr/pgmspace.h> when the
+     firmware is built for a Linux host.  The host has a single
+     address space, PROGMEM data is read in place.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+
+*****************************************************/
+
+#include <stdint.h>
+
+#define PROGMEM
+
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+
+#endif
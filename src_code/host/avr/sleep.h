@@ -0,0 +1,72 @@
+#ifndef _HAL_HOST_AVR_SLEEP_H_
+#define _HAL_HOST_AVR_SLEEP_H_
+
+/****************************************************
+    Host HAL - AVR sleep shim
+
+    File:   host/avr/sleep.h
+    Author: agent
+    agent AT local
+
+    host/avr/sleep.h file is part of the RGB LED Controller and Node
+     version 1 hardware project.
+
+    This file stands in for the avr-libc <avr/sleep.h> when the
+     firmware is built for a Linux host.  sleep_cpu() hands control
+     to hal_host.cpp which advances the simulation until an
+     interrupt wakes the "CPU".
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+
+*****************************************************/
+
+#include <avr/io.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void hal_host_sleep_enable(void);
+void hal_host_sleep_cpu(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define SLEEP_MODE_IDLE         (0)
+#define SLEEP_MODE_ADC          _BV(SM0)
+#define SLEEP_MODE_PWR_DOWN     _BV(SM1)
+#define SLEEP_MODE_PWR_SAVE     (_BV(SM0) | _BV(SM1))
+#define SLEEP_MODE_STANDBY      (_BV(SM1) | _BV(SM2))
+#define SLEEP_MODE_EXT_STANDBY  (_BV(SM0) | _BV(SM1) | _BV(SM2))
+
+#define set_sleep_mode(mode) \
+    do { SMCR = ((SMCR & ~(_BV(SM0) | _BV(SM1) | _BV(SM2))) | (mode)); } while (0)
+
+#define sleep_enable()      do { SMCR |= _BV(SE); hal_host_sleep_enable(); } while (0)
+#define sleep_disable()     do { SMCR &= ~_BV(SE); } while (0)
+#define sleep_bod_disable() do { MCUCR |= _BV(BODS); } while (0)
+#define sleep_cpu()         hal_host_sleep_cpu()
+
+#define sleep_mode() \
+    do { sleep_enable(); sleep_cpu(); sleep_disable(); } while (0)
+
+#endif
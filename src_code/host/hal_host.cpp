@@ -0,0 +1,599 @@
+/****************************************************
+    Host HAL
+
+    File:   host/hal_host.cpp
+    Author: agent
+    agent AT local
+
+    host/hal_host.cpp file is part of the RGB LED Controller and Node
+     version 1 hardware project.
+
+    This file contains the host (Linux) backend of the hardware
+     abstraction.  When the firmware is built with "make host" the
+     avr-libc headers are replaced by the shims in this directory and
+     every register access lands in a simulated ATmega328p register
+     file.  The hal_host class drives that register file:
+     - Pin levels (PINB/PINC/PIND) and the pin change flags
+     - USART0 receive and transmit
+     - Timer0, Timer1 and Timer2 counting, compare and overflow flags
+     - The fast PWM compare outputs of Timer0 and Timer2 (OCxA/OCxB)
+     - Dispatching of the pending and enabled interrupt vectors
+     - The PRR gates the timers and the USART like the real part
+    The firmware itself executes in zero simulated time, the simulated
+     clock only moves while the "CPU" sleeps (or when a test calls
+     AdvanceTime()).
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+    2026 Oct 17  agent              Timer2 prescaler taps.
+    2026 Oct 17  agent              Fast PWM compare outputs.
+    2026 Oct 17  agent              Nested interrupts, busy cycles
+                                      of the firmware.
+    2026 Oct 17  agent              Dispatch count of each vector.
+    2026 Oct 17  agent              Dispatch hook.
+    2026 Oct 17  agent              Raw UCSR0A.
+
+*****************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+
+#ifndef _HAL_HOST_H_
+#include "hal_host.h"
+#endif
+
+// The simulated data space
+volatile uint8_t hal_host_io[HAL_HOST_IO_SIZE];
+
+// Raw access to the interrupt flag registers (the names from avr/io.h
+//  are "write one to clear" proxies for the firmware)
+#define HOST_TIFR0  _SFR_IO8(0x15)
+#define HOST_TIFR1  _SFR_IO8(0x16)
+#define HOST_TIFR2  _SFR_IO8(0x17)
+#define HOST_PCIFR  _SFR_IO8(0x1B)
+
+// Raw USART status (the firmware's UCSR0A runs the interrupts due)
+#define HOST_UCSR0A _SFR_MEM8(0xC0)
+
+// Interrupt handlers.  Weak so that a vector the firmware does not
+//  implement simply resolves to null and is never dispatched.
+#define HAL_HOST_VECTOR(n) extern "C" void __vector_##n(void) __attribute__((weak));
+HAL_HOST_VECTOR(1)  HAL_HOST_VECTOR(2)  HAL_HOST_VECTOR(3)  HAL_HOST_VECTOR(4)
+HAL_HOST_VECTOR(5)  HAL_HOST_VECTOR(6)  HAL_HOST_VECTOR(7)  HAL_HOST_VECTOR(8)
+HAL_HOST_VECTOR(9)  HAL_HOST_VECTOR(10) HAL_HOST_VECTOR(11) HAL_HOST_VECTOR(12)
+HAL_HOST_VECTOR(13) HAL_HOST_VECTOR(14) HAL_HOST_VECTOR(15) HAL_HOST_VECTOR(16)
+HAL_HOST_VECTOR(17) HAL_HOST_VECTOR(18) HAL_HOST_VECTOR(19) HAL_HOST_VECTOR(20)
+HAL_HOST_VECTOR(21) HAL_HOST_VECTOR(22) HAL_HOST_VECTOR(23) HAL_HOST_VECTOR(24)
+HAL_HOST_VECTOR(25)
+#undef HAL_HOST_VECTOR
+
+typedef void (*VectorHandler)(void);
+
+static VectorHandler const vector_table[_VECTORS_SIZE] = {
+     0
+    ,__vector_1,  __vector_2,  __vector_3,  __vector_4,  __vector_5
+    ,__vector_6,  __vector_7,  __vector_8,  __vector_9,  __vector_10
+    ,__vector_11, __vector_12, __vector_13, __vector_14, __vector_15
+    ,__vector_16, __vector_17, __vector_18, __vector_19, __vector_20
+    ,__vector_21, __vector_22, __vector_23, __vector_24, __vector_25
+};
+
+hal_host::TxSink hal_host::_TxSink = hal_host::PrintTxSink;
+hal_host::IdleHook hal_host::_IdleHook = hal_host::ScriptIdleHook;
+hal_host::CycleHook hal_host::_CycleHook = 0;
+hal_host::DispatchHook hal_host::_DispatchHook = 0;
+uint64_t hal_host::_Cycles = 0;
+uint64_t hal_host::_WaitUntil = 0;
+uint32_t hal_host::_DispatchCount = 0;
+uint32_t hal_host::_VectorCount[_VECTORS_SIZE];
+uint32_t hal_host::_SleepDispatchCount = 0;
+uint32_t hal_host::_Timer0Prescale = 0;
+uint32_t hal_host::_Timer1Prescale = 0;
+uint32_t hal_host::_Timer2Prescale = 0;
+uint8_t hal_host::_Timer0Output = 0;
+uint8_t hal_host::_Timer2Output = 0;
+bool hal_host::_Timer1CountDown = false;
+uint32_t hal_host::_Busy[HAL_HOST_BUSY_SITES];
+uint8_t hal_host::_RxBuf[256];
+uint8_t hal_host::_RxHead = 0;
+uint8_t hal_host::_RxTail = 0;
+
+// Reset the register file before any static constructor of the
+//  firmware touches it.
+static void hal_host_power_on() __attribute__((constructor(101)));
+static void hal_host_power_on()
+{
+    hal_host::Reset();
+}
+
+void hal_host::Reset()
+{
+    for (uint16_t i = 0; i < HAL_HOST_IO_SIZE; i++) hal_host_io[i] = 0;
+
+    // Inputs float high (every input pin of the design has a pull up)
+    PINB = 0xFF;
+    PINC = 0x7F;
+    PIND = 0xFF;
+
+    // Transmitter is always ready
+    HOST_UCSR0A = (1 << UDRE0);
+
+    SP = RAMEND;
+
+    _Cycles = 0;
+    _WaitUntil = 0;
+    _DispatchCount = 0;
+    for (uint8_t i = 0; i < _VECTORS_SIZE; i++) _VectorCount[i] = 0;
+    _SleepDispatchCount = 0;
+    _Timer0Prescale = 0;
+    _Timer1Prescale = 0;
+    _Timer2Prescale = 0;
+    _Timer0Output = 0;
+    _Timer2Output = 0;
+    _Timer1CountDown = false;
+    for (uint8_t i = 0; i < HAL_HOST_BUSY_SITES; i++) _Busy[i] = 0;
+    _RxHead = 0;
+    _RxTail = 0;
+}
+
+static void pin_lookup(IOPinDefines::E_PinDef const &aPin
+                      ,volatile uint8_t *&aPinReg
+                      ,volatile uint8_t *&aPortReg
+                      ,volatile uint8_t *&aDDRReg
+                      ,uint8_t &aPcif
+                      ,volatile uint8_t *&aPcmsk
+                      ,uint8_t &aBit)
+{
+    if (aPin < IOPinDefines::E_PIN_PORTC_BASE) {
+        aPinReg = &PINB; aPortReg = &PORTB; aDDRReg = &DDRB;
+        aPcif = PCIF0; aPcmsk = &PCMSK0;
+        aBit = aPin - IOPinDefines::E_PIN_PORTB_BASE;
+    } else if (aPin < IOPinDefines::E_PIN_PORTD_BASE) {
+        aPinReg = &PINC; aPortReg = &PORTC; aDDRReg = &DDRC;
+        aPcif = PCIF1; aPcmsk = &PCMSK1;
+        aBit = aPin - IOPinDefines::E_PIN_PORTC_BASE;
+    } else {
+        aPinReg = &PIND; aPortReg = &PORTD; aDDRReg = &DDRD;
+        aPcif = PCIF2; aPcmsk = &PCMSK2;
+        aBit = aPin - IOPinDefines::E_PIN_PORTD_BASE;
+    }
+}
+
+void hal_host::SetPin(IOPinDefines::E_PinDef const &aPin, bool const &aLevel)
+{
+    if (aPin >= IOPinDefines::E_PIN_LAST_DEFINE) return;
+
+    volatile uint8_t *pin, *port, *ddr, *pcmsk;
+    uint8_t pcif, bit;
+    pin_lookup(aPin, pin, port, ddr, pcif, pcmsk, bit);
+
+    uint8_t const old = *pin;
+    if (aLevel) *pin = old | (1 << bit);
+    else        *pin = old & ~(1 << bit);
+
+    // Any logical change on an unmasked pin sets the port's flag
+    if ((old ^ *pin) & *pcmsk) HOST_PCIFR |= (1 << pcif);
+
+    Service();
+}
+
+bool hal_host::GetPin(IOPinDefines::E_PinDef const &aPin)
+{
+    if (aPin >= IOPinDefines::E_PIN_LAST_DEFINE) return false;
+
+    volatile uint8_t *pin, *port, *ddr, *pcmsk;
+    uint8_t pcif, bit;
+    pin_lookup(aPin, pin, port, ddr, pcif, pcmsk, bit);
+
+    // A connected compare output (COMx1 set) overrides the PORT bit
+    uint8_t com = 0;
+    uint8_t output = 0;
+    switch (aPin)
+    {
+    case IOPinDefines::E_PIN_PD6: com = TCCR0A >> COM0A0; output = _Timer0Output; break;
+    case IOPinDefines::E_PIN_PD5: com = TCCR0A >> COM0B0; output = _Timer0Output >> 1; break;
+    case IOPinDefines::E_PIN_PB3: com = TCCR2A >> COM2A0; output = _Timer2Output; break;
+    case IOPinDefines::E_PIN_PD3: com = TCCR2A >> COM2B0; output = _Timer2Output >> 1; break;
+    default: break;
+    }
+
+    if (com & 0x02)
+    {
+        // COMx0 inverts the output
+        return (*ddr & (1 << bit)) && ((output ^ com) & 0x01);
+    }
+
+    return (*ddr & *port & (1 << bit)) ? true : false;
+}
+
+void hal_host::UartReceive(uint8_t const &aByte)
+{
+    // Silently drop bytes if the host FIFO overflows
+    if ((uint8_t)(_RxHead + 1) == _RxTail) return;
+    _RxBuf[_RxHead++] = aByte;
+
+    Service();
+}
+
+uint16_t hal_host::Prescaler2(uint8_t const aClockSelect)
+{
+    // Timer2 has its own prescaler with more taps
+    switch (aClockSelect & 0x07)
+    {
+    case 1: return 1;
+    case 2: return 8;
+    case 3: return 32;
+    case 4: return 64;
+    case 5: return 128;
+    case 6: return 256;
+    case 7: return 1024;
+    default:
+        // Stopped
+    break;
+    }
+    return 0;
+}
+
+uint16_t hal_host::Prescaler(uint8_t const aClockSelect)
+{
+    switch (aClockSelect & 0x07)
+    {
+    case 1: return 1;
+    case 2: return 8;
+    case 3: return 64;
+    case 4: return 256;
+    case 5: return 1024;
+    default:
+        // Stopped or external clock (not simulated)
+    break;
+    }
+    return 0;
+}
+
+void hal_host::StepTimer8(uint8_t const &aPrr
+                         ,volatile uint8_t &aTCCRA
+                         ,volatile uint8_t &aTCCRB
+                         ,volatile uint8_t &aTCNT
+                         ,volatile uint8_t &aOCRA
+                         ,volatile uint8_t &aOCRB
+                         ,volatile uint8_t &aTIFR
+                         ,uint32_t &aPrescaleCount
+                         ,uint8_t &aOutput)
+{
+    if (PRR & (1 << aPrr)) return;
+
+    uint16_t const prescale = (aPrr == PRTIM2) ? Prescaler2(aTCCRB) : Prescaler(aTCCRB);
+    if (prescale == 0) return;
+
+    if (++aPrescaleCount < prescale) return;
+    aPrescaleCount = 0;
+
+    // WGMx2 lives in bit 3 of TCCRxB for both 8 bit timers
+    uint8_t const wgm = (aTCCRA & 0x03) | ((aTCCRB & (1 << 3)) ? 0x04 : 0);
+
+    uint8_t top;
+    if ((wgm == 2) || (wgm == 7)) top = aOCRA;
+    else top = 0xFF;
+
+    // Fast PWM compare outputs (bit 0 = OCxA, bit 1 = OCxB, non
+    //  inverted): high from BOTTOM through the compare value
+    if (aTCNT == aOCRA) aOutput &= ~0x01;
+    if (aTCNT == aOCRB) aOutput &= ~0x02;
+
+    if (aTCNT == top) {
+        aTCNT = 0;
+        aOutput = 0x03;
+        // Normal and fast PWM set the overflow flag at TOP
+        if ((wgm == 0) || (wgm == 3) || (wgm == 7)) aTIFR |= (1 << 0);
+    } else {
+        aTCNT = aTCNT + 1;
+    }
+
+    if (aTCNT == aOCRA) aTIFR |= (1 << 1);
+    if (aTCNT == aOCRB) aTIFR |= (1 << 2);
+}
+
+void hal_host::StepTimer1()
+{
+    if (PRR & (1 << PRTIM1)) return;
+
+    uint16_t const prescale = Prescaler(TCCR1B);
+    if (prescale == 0) return;
+
+    if (++_Timer1Prescale < prescale) return;
+    _Timer1Prescale = 0;
+
+    uint8_t const wgm = (TCCR1A & 0x03) | ((TCCR1B >> WGM12) & 0x03) << 2;
+
+    if (wgm == 8) {
+        // Phase and frequency correct PWM, TOP = ICR1.
+        //  TOV1 is set when the counter reaches BOTTOM.
+        uint16_t const top = ICR1;
+        if (_Timer1CountDown) {
+            if (TCNT1 == 0) {
+                _Timer1CountDown = false;
+                TCNT1 = 1;
+            } else {
+                TCNT1 = TCNT1 - 1;
+                if (TCNT1 == 0) HOST_TIFR1 |= (1 << TOV1);
+            }
+        } else {
+            if (TCNT1 >= top) {
+                _Timer1CountDown = true;
+                TCNT1 = top - 1;
+            } else {
+                TCNT1 = TCNT1 + 1;
+            }
+        }
+    } else {
+        uint16_t const top = (wgm == 4) ? OCR1A : 0xFFFF;
+        if (TCNT1 == top) {
+            TCNT1 = 0;
+            if (wgm != 4) HOST_TIFR1 |= (1 << TOV1);
+        } else {
+            TCNT1 = TCNT1 + 1;
+        }
+    }
+
+    if (TCNT1 == OCR1A) HOST_TIFR1 |= (1 << OCF1A);
+    if (TCNT1 == OCR1B) HOST_TIFR1 |= (1 << OCF1B);
+}
+
+bool hal_host::PendingVector(uint8_t &aVector)
+{
+    // Lowest vector number has the highest priority
+    if ((HOST_PCIFR & (1 << PCIF0)) && (PCICR & (1 << PCIE0))) { aVector = 3; return true; }
+    if ((HOST_PCIFR & (1 << PCIF1)) && (PCICR & (1 << PCIE1))) { aVector = 4; return true; }
+    if ((HOST_PCIFR & (1 << PCIF2)) && (PCICR & (1 << PCIE2))) { aVector = 5; return true; }
+
+    if (HOST_TIFR2 & TIMSK2 & (1 << OCF2A)) { aVector = 7; return true; }
+    if (HOST_TIFR2 & TIMSK2 & (1 << OCF2B)) { aVector = 8; return true; }
+    if (HOST_TIFR2 & TIMSK2 & (1 << TOV2))  { aVector = 9; return true; }
+
+    if (HOST_TIFR1 & TIMSK1 & (1 << OCF1A)) { aVector = 11; return true; }
+    if (HOST_TIFR1 & TIMSK1 & (1 << OCF1B)) { aVector = 12; return true; }
+    if (HOST_TIFR1 & TIMSK1 & (1 << TOV1))  { aVector = 13; return true; }
+
+    if (HOST_TIFR0 & TIMSK0 & (1 << OCF0A)) { aVector = 14; return true; }
+    if (HOST_TIFR0 & TIMSK0 & (1 << OCF0B)) { aVector = 15; return true; }
+    if (HOST_TIFR0 & TIMSK0 & (1 << TOV0))  { aVector = 16; return true; }
+
+    if (!(PRR & (1 << PRUSART0))) {
+        if ((_RxHead != _RxTail)
+         && (UCSR0B & (1 << RXCIE0))
+         && (UCSR0B & (1 << RXEN0))) { aVector = 18; return true; }
+
+        if ((UCSR0B & (1 << UDRIE0))
+         && (UCSR0B & (1 << TXEN0))) { aVector = 19; return true; }
+    }
+
+    return false;
+}
+
+void hal_host::Dispatch(uint8_t const &aVector)
+{
+    // Hardware clears the flag when the vector is taken
+    switch (aVector)
+    {
+    case 3:  HOST_PCIFR &= ~(1 << PCIF0); break;
+    case 4:  HOST_PCIFR &= ~(1 << PCIF1); break;
+    case 5:  HOST_PCIFR &= ~(1 << PCIF2); break;
+    case 7:  HOST_TIFR2 &= ~(1 << OCF2A); break;
+    case 8:  HOST_TIFR2 &= ~(1 << OCF2B); break;
+    case 9:  HOST_TIFR2 &= ~(1 << TOV2);  break;
+    case 11: HOST_TIFR1 &= ~(1 << OCF1A); break;
+    case 12: HOST_TIFR1 &= ~(1 << OCF1B); break;
+    case 13: HOST_TIFR1 &= ~(1 << TOV1);  break;
+    case 14: HOST_TIFR0 &= ~(1 << OCF0A); break;
+    case 15: HOST_TIFR0 &= ~(1 << OCF0B); break;
+    case 16: HOST_TIFR0 &= ~(1 << TOV0);  break;
+    case 18:
+        UDR0 = _RxBuf[_RxTail++];
+        HOST_UCSR0A |= (1 << RXC0);
+    break;
+    default:
+    break;
+    }
+
+    _DispatchCount++;
+    _VectorCount[aVector]++;
+
+    if (_DispatchHook) _DispatchHook(aVector, true);
+    if (vector_table[aVector]) vector_table[aVector]();
+    if (_DispatchHook) _DispatchHook(aVector, false);
+
+    switch (aVector)
+    {
+    case 18:
+        HOST_UCSR0A &= ~(1 << RXC0);
+    break;
+    case 19:
+        // The UDRE handler disables UDRIE0 when the buffer ran
+        //  empty, otherwise it has just written a byte to UDR0.
+        if ((UCSR0B & (1 << UDRIE0)) && _TxSink) {
+            uint8_t const data = UDR0;
+            _TxSink(data);
+        }
+    break;
+    default:
+    break;
+    }
+}
+
+void hal_host::Service()
+{
+    uint8_t vector;
+    while ((SREG & (1 << SREG_I)) && PendingVector(vector)) {
+        SREG &= ~(1 << SREG_I);
+        Dispatch(vector);
+        SREG |= (1 << SREG_I);
+    }
+}
+
+void hal_host::SetBusy(uint8_t const &aSite, uint32_t const &aCycles)
+{
+    if (aSite < HAL_HOST_BUSY_SITES) _Busy[aSite] = aCycles;
+}
+
+void hal_host::AdvanceTime(uint32_t const &aCycles)
+{
+    for (uint32_t i = 0; i < aCycles; i++) {
+        _Cycles++;
+        StepTimer8(PRTIM0, TCCR0A, TCCR0B, TCNT0, OCR0A, OCR0B, HOST_TIFR0, _Timer0Prescale, _Timer0Output);
+        StepTimer1();
+        StepTimer8(PRTIM2, TCCR2A, TCCR2B, TCNT2, OCR2A, OCR2B, HOST_TIFR2, _Timer2Prescale, _Timer2Output);
+        Service();
+        if (_CycleHook) _CycleHook();
+    }
+}
+
+uint32_t hal_host::AdvanceUntilInterrupt(uint32_t const &aCycles)
+{
+    uint32_t const start = _DispatchCount;
+    uint32_t i = 0;
+    while ((i < aCycles) && (_DispatchCount == start)) {
+        AdvanceTime(1);
+        i++;
+    }
+    return i;
+}
+
+void hal_host::SleepEnable()
+{
+    _SleepDispatchCount = _DispatchCount;
+}
+
+void hal_host::SleepCpu()
+{
+    // An interrupt taken between sleep_enable() and sleep_cpu()
+    //  means there is new work.  Wake up immediately.
+    Service();
+    if (_DispatchCount != _SleepDispatchCount) return;
+
+    // Sleep with interrupts disabled never wakes up
+    if (!(SREG & (1 << SREG_I))) {
+        fprintf(stderr, "hal_host: sleep with interrupts disabled\n");
+        exit(1);
+    }
+
+    while (_DispatchCount == _SleepDispatchCount) {
+        if (_Cycles < _WaitUntil) {
+            AdvanceUntilInterrupt((uint32_t)(_WaitUntil - _Cycles));
+        } else if (!_IdleHook || !_IdleHook()) {
+            exit(0);
+        }
+    }
+}
+
+static bool parse_pin(char const *aName, IOPinDefines::E_PinDef &aPin)
+{
+    if ((strlen(aName) != 3) || (aName[0] != 'P')) return false;
+    uint8_t const bit = aName[2] - '0';
+    if (bit > 7) return false;
+    switch (aName[1])
+    {
+    case 'B': aPin = (IOPinDefines::E_PinDef)(IOPinDefines::E_PIN_PORTB_BASE + bit); return true;
+    case 'C': aPin = (IOPinDefines::E_PinDef)(IOPinDefines::E_PIN_PORTC_BASE + bit); return bit < 7;
+    case 'D': aPin = (IOPinDefines::E_PinDef)(IOPinDefines::E_PIN_PORTD_BASE + bit); return true;
+    default:
+    break;
+    }
+    return false;
+}
+
+bool hal_host::ScriptIdleHook()
+{
+    char line[256];
+
+    while (fgets(line, sizeof(line), stdin)) {
+        char *cmd = strtok(line, " \t\r\n");
+        if (!cmd || (cmd[0] == '#')) continue;
+
+        if (!strcmp(cmd, "pin")) {
+            char const *name = strtok(0, " \t\r\n");
+            char const *level = strtok(0, " \t\r\n");
+            IOPinDefines::E_PinDef pin;
+            if (!name || !level || !parse_pin(name, pin)) {
+                fprintf(stderr, "hal_host: bad pin command\n");
+                continue;
+            }
+            SetPin(pin, atoi(level) != 0);
+        } else if (!strcmp(cmd, "rx")) {
+            char const *byte;
+            while ((byte = strtok(0, " \t\r\n"))) {
+                UartReceive((uint8_t)strtoul(byte, 0, 16));
+            }
+        } else if (!strcmp(cmd, "wait")) {
+            char const *msecs = strtok(0, " \t\r\n");
+            if (msecs) _WaitUntil = _Cycles + (uint64_t)strtoul(msecs, 0, 0) * (F_CPU / 1000UL);
+        } else if (!strcmp(cmd, "cycles")) {
+            char const *cycles = strtok(0, " \t\r\n");
+            if (cycles) _WaitUntil = _Cycles + strtoull(cycles, 0, 0);
+        } else {
+            fprintf(stderr, "hal_host: unknown command %s\n", cmd);
+            continue;
+        }
+        return true;
+    }
+    return false;
+}
+
+void hal_host::PrintTxSink(uint8_t const &aByte)
+{
+    printf("tx %02X\n", aByte);
+    fflush(stdout);
+}
+
+// C linkage entry points for the avr-libc shims
+extern "C" void hal_host_sei(void)
+{
+    SREG |= (1 << SREG_I);
+    hal_host::Service();
+}
+
+extern "C" void hal_host_cli(void)
+{
+    SREG &= ~(1 << SREG_I);
+}
+
+extern "C" void hal_host_poll(void)
+{
+    hal_host::Service();
+}
+
+extern "C" void hal_host_busy(unsigned char aSite)
+{
+    if (aSite < HAL_HOST_BUSY_SITES) hal_host::AdvanceTime(hal_host::Busy(aSite));
+}
+
+extern "C" void hal_host_sleep_enable(void)
+{
+    hal_host::SleepEnable();
+}
+
+extern "C" void hal_host_sleep_cpu(void)
+{
+    hal_host::SleepCpu();
+}
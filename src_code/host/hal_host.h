@@ -0,0 +1,184 @@
+#ifndef _HAL_HOST_H_
+#define _HAL_HOST_H_
+
+/****************************************************
+    Host HAL
+
+    File:   host/hal_host.h
+    Author: agent
+    agent AT local
+
+    host/hal_host.h file is part of the RGB LED Controller and Node
+     version 1 hardware project.
+
+    This file contains the host (Linux) backend of the hardware
+     abstraction.  When the firmware is built with "make host" the
+     avr-libc headers are replaced by the shims in this directory and
+     every register access lands in a simulated ATmega328p register
+     file.  The hal_host class drives that register file:
+     - Pin levels (PINB/PINC/PIND) and the pin change flags
+     - USART0 receive and transmit
+     - Timer0, Timer1 and Timer2 counting, compare and overflow flags
+     - Dispatching of the pending and enabled interrupt vectors
+     - The PRR gates the timers and the USART like the real part
+    The firmware itself executes in zero simulated time, the simulated
+     clock only moves while the "CPU" sleeps (or when a test calls
+     AdvanceTime()).
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+    2026 Oct 17  agent              Fast PWM compare outputs.
+    2026 Oct 17  agent              Nested interrupts, busy cycles
+                                      of the firmware.
+    2026 Oct 17  agent              Dispatch count of each vector.
+    2026 Oct 17  agent              Dispatch hook.
+
+*****************************************************/
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+#ifndef _PIN_CLASS_H_
+#include "pin_class.h"
+#endif
+
+class hal_host
+{
+public:
+    // Called with every byte the firmware writes to UDR0
+    typedef void (*TxSink)(uint8_t const &aByte);
+
+    // Called when the firmware goes to sleep and no interrupt is
+    //  pending.  The hook injects stimulus and/or advances time.
+    //  Returning false ends the simulation.
+    typedef bool (*IdleHook)();
+
+    // Called after every simulated CPU cycle, also the cycles an ISR
+    //  is busy for (a test samples the pins here)
+    typedef void (*CycleHook)();
+
+    // Called before (aEnter true) and after every ISR dispatched,
+    //  nested ones too (a benchmark times the ISRs here)
+    typedef void (*DispatchHook)(uint8_t const &aVector, bool const &aEnter);
+
+    // Restore the register file to its reset values
+    static void Reset();
+
+    // Drive an input pin.  A change on a pin enabled in PCMSKx
+    //  raises the matching pin change interrupt.
+    static void SetPin(IOPinDefines::E_PinDef const &aPin, bool const &aLevel);
+
+    // Output level of a pin as driven by the firmware (PORTx & DDRx,
+    //  or the compare output of Timer0/Timer2 in fast PWM mode)
+    static bool GetPin(IOPinDefines::E_PinDef const &aPin);
+
+    // Queue a byte on the USART receiver
+    static void UartReceive(uint8_t const &aByte);
+
+    // Advance the simulated clock by CPU cycles.  Interrupts raised
+    //  along the way are dispatched as they occur.
+    static void AdvanceTime(uint32_t const &aCycles);
+
+    // Advance the simulated clock until an interrupt is dispatched
+    //  or aCycles have elapsed.  Returns the cycles consumed.
+    static uint32_t AdvanceUntilInterrupt(uint32_t const &aCycles);
+
+    // Dispatch every pending and enabled interrupt (if I is set).
+    //  An ISR that sets I is interrupted like on the target.
+    static void Service();
+
+    // CPU cycles hal_host_busy(aSite) advances the clock by.  The
+    //  firmware costs nothing on the host unless a test sets them.
+    static void SetBusy(uint8_t const &aSite, uint32_t const &aCycles);
+    static uint32_t Busy(uint8_t const &aSite) { return _Busy[aSite]; }
+
+    static void SetTxSink(TxSink const &A) { _TxSink = A; }
+    static void SetIdleHook(IdleHook const &A) { _IdleHook = A; }
+    static void SetCycleHook(CycleHook const &A) { _CycleHook = A; }
+    static void SetDispatchHook(DispatchHook const &A) { _DispatchHook = A; }
+
+    // Simulated CPU cycles since reset
+    static uint64_t Cycles() { return _Cycles; }
+
+    // Number of interrupts dispatched since reset
+    static uint32_t DispatchCount() { return _DispatchCount; }
+
+    // Number of times the vector (<name>_vect_num) was dispatched
+    static uint32_t VectorCount(uint8_t const &aVector)
+    {
+        return (aVector < _VECTORS_SIZE) ? _VectorCount[aVector] : 0;
+    }
+
+    // Called by the avr/sleep.h shim
+    static void SleepEnable();
+    static void SleepCpu();
+
+    // Default stimulus: reads a script from stdin
+    //  pin <PB0..PD7> <0|1>     drive an input pin
+    //  rx <hex> [<hex> ...]     receive bytes on the USART
+    //  wait <msecs>             let the simulated clock run
+    //  cycles <n>               let the simulated clock run
+    //  # ...                    comment
+    // End of file ends the simulation.
+    static bool ScriptIdleHook();
+
+    // Default transmit sink: prints "tx XX" to stdout
+    static void PrintTxSink(uint8_t const &aByte);
+
+private:
+    hal_host();
+
+    static bool PendingVector(uint8_t &aVector);
+    static void Dispatch(uint8_t const &aVector);
+    static void StepTimer8(uint8_t const &aPrr
+                          ,volatile uint8_t &aTCCRA
+                          ,volatile uint8_t &aTCCRB
+                          ,volatile uint8_t &aTCNT
+                          ,volatile uint8_t &aOCRA
+                          ,volatile uint8_t &aOCRB
+                          ,volatile uint8_t &aTIFR
+                          ,uint32_t &aPrescaleCount
+                          ,uint8_t &aOutput);
+    static void StepTimer1();
+    static uint16_t Prescaler(uint8_t const aClockSelect);
+    static uint16_t Prescaler2(uint8_t const aClockSelect);
+
+    static TxSink _TxSink;
+    static IdleHook _IdleHook;
+    static CycleHook _CycleHook;
+    static DispatchHook _DispatchHook;
+    static uint64_t _Cycles;
+    static uint64_t _WaitUntil;
+    static uint32_t _DispatchCount;
+    static uint32_t _VectorCount[_VECTORS_SIZE];
+    static uint32_t _SleepDispatchCount;
+    static uint32_t _Timer0Prescale;
+    static uint32_t _Timer1Prescale;
+    static uint32_t _Timer2Prescale;
+    static uint8_t _Timer0Output;
+    static uint8_t _Timer2Output;
+    static bool _Timer1CountDown;
+    static uint32_t _Busy[HAL_HOST_BUSY_SITES];
+    static uint8_t _RxBuf[256];
+    static uint8_t _RxHead;
+    static uint8_t _RxTail;
+};
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef _HAL_HOST_UTIL_ATOMIC_H_
+#define _HAL_HOST_UTIL_ATOMIC_H_
+
+/****************************************************
+    Host HAL - AVR atomic block shim
+
+    File:   host/util/atomic.h
+    Author: agent
+    agent AT local
+
+    host/util/atomic.h file is part of the RGB LED Controller and Node
+     version 1 hardware project.
+
+    This file stands in for the avr-libc <util/atomic.h> when the
+     firmware is built for a Linux host.  The blocks save, clear and
+     restore the I bit of the simulated SREG exactly like avr-libc.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+
+*****************************************************/
+
+#include <avr/interrupt.h>
+
+static __inline__ uint8_t __iCliRetVal(void)
+{
+    cli();
+    return 1;
+}
+
+static __inline__ uint8_t __iSeiRetVal(void)
+{
+    sei();
+    return 1;
+}
+
+static __inline__ void __iSeiParam(const uint8_t *__s)
+{
+    (void)__s;
+    sei();
+}
+
+static __inline__ void __iCliParam(const uint8_t *__s)
+{
+    (void)__s;
+    cli();
+}
+
+static __inline__ void __iRestore(const uint8_t *__s)
+{
+    if (*__s & _BV(SREG_I)) sei();
+    else cli();
+}
+
+#define ATOMIC_BLOCK(type) for ( type, __ToDo = __iCliRetVal(); \
+                                 __ToDo ; __ToDo = 0 )
+
+#define NONATOMIC_BLOCK(type) for ( type, __ToDo = __iSeiRetVal(); \
+                                    __ToDo ; __ToDo = 0 )
+
+#define ATOMIC_RESTORESTATE uint8_t sreg_save \
+    __attribute__((__cleanup__(__iRestore))) = SREG
+
+#define ATOMIC_FORCEON uint8_t sreg_save \
+    __attribute__((__cleanup__(__iSeiParam))) = 0
+
+#define NONATOMIC_RESTORESTATE uint8_t sreg_save \
+    __attribute__((__cleanup__(__iRestore))) = SREG
+
+#define NONATOMIC_FORCEOFF uint8_t sreg_save \
+    __attribute__((__cleanup__(__iCliParam))) = 0
+
+#endif
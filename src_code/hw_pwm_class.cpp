@@ -0,0 +1,146 @@
+/****************************************************
+    Hardware PWM Class
+
+    File:   hw_pwm_class.cpp
+    Author: agent
+    agent AT local
+
+    hw_pwm_class.cpp file is part of the RGB LED Controller and Node 
+     version 1 hardware project.
+
+    This file contains the allocator and the Timer0 setup of the
+     hardware PWM channels.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+
+*****************************************************/
+
+#include <util/atomic.h>
+
+#ifndef _HW_PWM_CLASS_H_
+#include "hw_pwm_class.h"
+#endif
+
+#ifndef _MCU_SLEEP_CLASS_H_
+#include "mcu_sleep_class.h"
+#endif
+
+#ifndef _TIMEBASE_CLASS_H_
+#include "timebase_class.h"
+#endif
+
+uint8_t hw_pwm_class::_Allocated = 0;
+uint8_t hw_pwm_class::_ActiveLow = 0;
+uint8_t hw_pwm_class::_Connected = 0;
+
+uint8_t hw_pwm_class::Allocate(IOPinDefines::E_PinDef const &A
+                              ,bool const &ActiveLow)
+{
+#if HW_PWM
+    uint8_t channel;
+
+    switch (A)
+    {
+    case IOPinDefines::E_PIN_PD6:
+        channel = E_HW_PWM_OC0A;
+    break;
+    case IOPinDefines::E_PIN_PD5:
+        channel = E_HW_PWM_OC0B;
+    break;
+    default:
+        // No compare unit to hand out
+        return E_HW_PWM_NONE;
+    }
+
+    if (_Allocated & (1 << channel)) return E_HW_PWM_NONE;
+
+    _Allocated |= (1 << channel);
+    if (ActiveLow) _ActiveLow |= (1 << channel);
+
+    return channel;
+#else
+    (void)A;
+    (void)ActiveLow;
+    return E_HW_PWM_NONE;
+#endif
+}
+
+// COM0x bits of the channel: non inverting, or inverting for active low
+static inline uint8_t hw_pwm_com(uint8_t const &Channel, bool const &ActiveLow)
+{
+    uint8_t const com = ActiveLow ? ((1 << COM0A1) | (1 << COM0A0)) : (1 << COM0A1);
+    return (Channel == hw_pwm_class::E_HW_PWM_OC0A) ? com : (com >> (COM0A0 - COM0B0));
+}
+
+void hw_pwm_class::SetDuty(uint8_t const &Channel, uint8_t const &A)
+{
+    if (Channel >= E_HW_PWM_LAST_CHANNEL) return;
+
+    // Fast PWM: the pin is lit from BOTTOM through OCR0x.  OCR0x is
+    //  double buffered, the new duty starts with the next period.
+    uint8_t const ocr = A ? (A - 1) : 0;
+    if (Channel == E_HW_PWM_OC0A) OCR0A = ocr;
+    else OCR0B = ocr;
+
+    if (_Connected & (1 << Channel)) return;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        if (_Connected == 0)
+        {
+            // First channel ... power up Timer0
+            mcu_sleep_class::getInstance()->SetInterfaceUsage(
+                mcu_sleep_class::E_TIMER_ZERO_INTERFACE,
+                mcu_sleep_class::E_POWER_INTERFACE_DISABLE_POWER_SAVINGS);
+
+            // Keep the clock of the timebase if it runs Timer0
+            if ((TCCR0B & ((1 << CS02) | (1 << CS01) | (1 << CS00))) == 0)
+            {
+                TCCR0B = HW_PWM_CLOCK_SELECT;
+            }
+        }
+        _Connected |= (1 << Channel);
+
+        TCCR0A |= (1 << WGM01) | (1 << WGM00)
+               |  hw_pwm_com(Channel, _ActiveLow & (1 << Channel));
+    }
+}
+
+void hw_pwm_class::Disconnect(uint8_t const &Channel)
+{
+    if (Channel >= E_HW_PWM_LAST_CHANNEL) return;
+    if ((_Connected & (1 << Channel)) == 0) return;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        TCCR0A &= ~hw_pwm_com(Channel, true);
+        _Connected &= ~(1 << Channel);
+
+#if !TIMEBASE_IN_USE
+        if (_Connected == 0)
+        {
+            // Last channel ... stop and power down Timer0
+            TCCR0B = 0;
+            mcu_sleep_class::getInstance()->SetInterfaceUsage(
+                mcu_sleep_class::E_TIMER_ZERO_INTERFACE,
+                mcu_sleep_class::E_POWER_INTERFACE_ENABLE_POWER_SAVINGS);
+        }
+#endif
+    }
+}
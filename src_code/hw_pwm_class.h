@@ -0,0 +1,97 @@
+#ifndef _HW_PWM_CLASS_H_
+#define _HW_PWM_CLASS_H_
+
+/****************************************************
+    Hardware PWM Class
+
+    File:   hw_pwm_class.h
+    Author: agent
+    agent AT local
+
+    hw_pwm_class.h file is part of the RGB LED Controller and Node 
+     version 1 hardware project.
+
+    This file contains the allocator of the hardware PWM channels.
+     pwm_class asks for the compare unit of its pin, a channel that
+     gets one runs in the timer hardware and costs no ISR time.  The
+     other pins stay with the software PWM engine on Timer2.
+    - OC0A (PD6) and OC0B (PD5) run Timer0 in fast PWM mode.  The
+       overflow still comes at 0xFF, the timebase shares Timer0.
+    - OC1A (PB1) and OC1B (PB2) are not handed out, Timer1 belongs
+       to the event timers (timer_class).
+    - OC2A (PB3) and OC2B (PD3) are not handed out, Timer2 is the
+       software PWM engine.
+    - Timer0 is powered (mcu_sleep_class) while a channel drives
+       its pin.  The sleep modes past IDLE stop it.
+    - The controller board has buttons 2 and 3 on PD6 and PD5, none
+       of its LEDs can take a channel.  HW_PWM is 0 in the Makefile,
+       set it for a board with LEDs on OC0A/OC0B.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+    2026 Oct 17  agent              Off by default, no LED of the
+                                      controller is on OC0A/OC0B.
+
+*****************************************************/
+
+#include <avr/io.h>
+
+#ifndef _PIN_CLASS_H_
+#include "pin_class.h"
+#endif
+
+#ifndef HW_PWM
+#define HW_PWM 0
+#endif
+
+// Timer0 clock when the timebase does not run it (ck/64, 488Hz)
+#define HW_PWM_CLOCK_SELECT ((1 << CS01) | (1 << CS00))
+
+class hw_pwm_class
+{
+public:
+    enum E_HwPwmChannel
+    {
+         E_HW_PWM_OC0A = 0
+        ,E_HW_PWM_OC0B
+        ,E_HW_PWM_LAST_CHANNEL
+        ,E_HW_PWM_NONE = 0xFF
+    };
+
+    // Channel of the compare unit of pin A.  E_HW_PWM_NONE when the
+    //  pin has no unit to hand out or it is taken.  ActiveLow for
+    //  LEDs tied to V+ (common anode).
+    static uint8_t Allocate(IOPinDefines::E_PinDef const &A
+                           ,bool const &ActiveLow);
+
+    // Drive the pin, lit for A/256 of the period (A = 1..255)
+    static void SetDuty(uint8_t const &Channel, uint8_t const &A);
+
+    // Hand the pin back to its PORT bit
+    static void Disconnect(uint8_t const &Channel);
+
+private:
+    // Channels handed out, inverted and driving their pin
+    static uint8_t _Allocated;
+    static uint8_t _ActiveLow;
+    static uint8_t _Connected;
+};
+
+#endif
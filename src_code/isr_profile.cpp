@@ -0,0 +1,109 @@
+/****************************************************
+    ISR Profile
+
+    File:   isr_profile.cpp
+    Author: agent
+    agent AT local
+
+    isr_profile.cpp file is part of the RGB LED Controller and Node 
+     version 1 hardware project.
+
+    This file contains the ISR profile table and its report.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+
+*****************************************************/
+
+#include <util/atomic.h>
+
+#ifndef _ISR_PROFILE_H_
+#include "isr_profile.h"
+#endif
+
+#ifndef _COMM_CLASS_H_
+#include "comm_class.h"
+#endif
+
+#if ISR_PROFILE
+
+isr_profile::isr_stats_struct isr_profile::_Stats[E_ISR_LAST_VECTOR];
+uint8_t isr_profile::_Timer2LatencyMax = 0;
+uint16_t isr_profile::_UartOverruns = 0;
+
+void isr_profile::Clear()
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        for (uint8_t i = 0; i < E_ISR_LAST_VECTOR; i++)
+        {
+            _Stats[i]._Count = 0;
+            _Stats[i]._Max = 0;
+            _Stats[i]._Total = 0;
+        }
+        _Timer2LatencyMax = 0;
+        _UartOverruns = 0;
+    }
+}
+
+void isr_profile::Report(comm_class &aComm, bool const &clear)
+{
+    uint8_t prescale_log2 = 0;
+    while ((1UL << prescale_log2) < TIMEBASE_PRESCALE) prescale_log2++;
+
+    aComm.report_data(prescale_log2);
+    aComm.report_data(E_ISR_LAST_VECTOR);
+
+    for (uint8_t i = 0; i < E_ISR_LAST_VECTOR; i++)
+    {
+        // Take a consistent copy, the ISRs keep updating the table
+        isr_stats_struct stats;
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+        {
+            stats = _Stats[i];
+        }
+
+        aComm.report_data(i);
+        aComm.report_data16(stats._Count);
+        aComm.report_data16(stats._Max);
+        aComm.report_data32(stats._Total);
+    }
+
+    uint8_t latency;
+    uint16_t overruns;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        latency = _Timer2LatencyMax;
+        overruns = _UartOverruns;
+    }
+    aComm.report_data(latency);
+    aComm.report_data16(overruns);
+
+    if (clear) Clear();
+}
+
+#else
+
+void isr_profile::Report(comm_class &, bool const &)
+{
+    // Not built in ... empty report.
+}
+
+#endif
@@ -0,0 +1,159 @@
+#ifndef _ISR_PROFILE_H_
+#define _ISR_PROFILE_H_
+
+/****************************************************
+    ISR Profile
+
+    File:   isr_profile.h
+    Author: agent
+    agent AT local
+
+    isr_profile.h file is part of the RGB LED Controller and Node 
+     version 1 hardware project.
+
+    This file contains the optional ISR duration and latency
+     instrumentation (ISR_PROFILE=1 in the Makefile).
+    - Every ISR is wrapped with ISR_PROFILE_ENTER/ISR_PROFILE_EXIT
+       which stamp the Timer0 timebase (see timebase_class.h).
+    - Per vector: count, max and cumulative duration in timebase ticks.
+       The ISR prologue/epilogue (register save/restore) is not
+       included.
+    - Timer2 entry latency: TCNT2 at ISR entry is the number of Timer2
+       ticks since the compare match that requested the interrupt.
+    - USART0 data overrun count (DOR0), ie RX bytes lost because the
+       RX ISR was held off for longer than two character times.
+    - The Timer2 duration includes the ISRs nested in the frame work
+       of the PWM engines (run with interrupts enabled).
+    The table is sent with the E_REPORT_ISR_PROFILE report.
+
+    Before/after numbers of an ISR change come from two builds with the
+    same options, run on the part with the same stimulus and the report
+    read at the same point.  The host build charges no cycles to the
+    firmware, no host figure stands in for them.  "make bench" ranks
+    the paths in host ns, with BENCH_SCENARIO=tools/bench_pin_scenario.txt
+    and DEFERRED_WORK=0 for the pin change dispatch.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+    2026 Oct 17  agent              Timer2 latency of the free
+                                      running edge PWM engine.
+    2026 Oct 17  agent              How before/after numbers are
+                                      taken.
+    2026 Oct 17  agent              Host bench of the pin change
+                                      dispatch.
+
+*****************************************************/
+
+#include <avr/io.h>
+
+#ifndef _TIMEBASE_CLASS_H_
+#include "timebase_class.h"
+#endif
+
+class comm_class;
+
+class isr_profile
+{
+public:
+    // Profiled vectors
+    typedef enum {
+         E_ISR_PCINT0
+        ,E_ISR_PCINT1
+        ,E_ISR_PCINT2
+        ,E_ISR_TIMER2_COMPA
+        ,E_ISR_TIMER1_OVF
+        ,E_ISR_USART_RX
+        ,E_ISR_USART_UDRE
+        ,E_ISR_SPI_STC
+        ,E_ISR_TWI
+
+        // Must remain the last enum
+        ,E_ISR_LAST_VECTOR
+    } E_IsrVector;
+
+    struct isr_stats_struct {
+        uint16_t _Count;
+        uint16_t _Max;
+        uint32_t _Total;
+    };
+
+    // Called at the end of each ISR with the ENTER stamp
+    static void Exit(E_IsrVector const &A, uint16_t const &start)
+    {
+        uint16_t const duration = timebase_class::NowFromIsr() - start;
+        isr_stats_struct &stats = _Stats[A];
+
+        if (stats._Count != 0xFFFF) stats._Count++;
+        stats._Total += duration;
+        if (duration > stats._Max) stats._Max = duration;
+    }
+
+    // Called at the start of the Timer2 ISR with TCNT2.  In CTC mode
+    //  the flag is raised while TCNT2 == OCR2A and the counter clears
+    //  on the next Timer2 tick.  Free running (edge PWM engine) the
+    //  counter just passes OCR2A.
+    static void Timer2Latency(uint8_t const A)
+    {
+        uint8_t latency;
+        if (TCCR2A & (1 << WGM21)) latency = (A == OCR2A) ? 0 : A + 1;
+        else latency = A - OCR2A;
+        if (latency > _Timer2LatencyMax) _Timer2LatencyMax = latency;
+    }
+
+    static void UartOverrun()
+    {
+        if (_UartOverruns != 0xFFFF) _UartOverruns++;
+    }
+
+    /*
+        Report format (E_REPORT_ISR_PROFILE):
+            TIMEBASE_PRESCALE log2 (1 byte) - cycles per tick = 1 << value
+            Number of vectors      (1 byte)
+            Per vector:
+                Vector (E_IsrVector) (1 byte)
+                Count                (2 bytes, little endian)
+                Max ticks            (2 bytes, little endian)
+                Total ticks          (4 bytes, little endian)
+            Timer2 max entry latency (1 byte, Timer2 ticks)
+            USART0 data overruns     (2 bytes, little endian)
+    */
+    static void Report(comm_class &aComm, bool const &clear);
+
+private:
+    static void Clear();
+
+    static isr_stats_struct _Stats[E_ISR_LAST_VECTOR];
+    static uint8_t _Timer2LatencyMax;
+    static uint16_t _UartOverruns;
+};
+
+#if ISR_PROFILE
+#define ISR_PROFILE_ENTER()    uint16_t const _isr_profile_start = timebase_class::NowFromIsr()
+#define ISR_PROFILE_EXIT(A)    isr_profile::Exit(isr_profile::A, _isr_profile_start)
+#define ISR_PROFILE_TIMER2_LATENCY(A) isr_profile::Timer2Latency(A)
+#define ISR_PROFILE_UART_OVERRUN()    isr_profile::UartOverrun()
+#else
+#define ISR_PROFILE_ENTER()
+#define ISR_PROFILE_EXIT(A)
+#define ISR_PROFILE_TIMER2_LATENCY(A)
+#define ISR_PROFILE_UART_OVERRUN()
+#endif
+
+#endif
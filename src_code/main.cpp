@@ -31,6 +31,8 @@
      When         Who                Description of change
     -----------  ----------         ------------------------
     2014 Nov 18  James Stokebrand   Initial creation.
+    2026 Oct 17  agent              No HW_PWM build, its pins are
+                                      buttons 2 and 3.
 
 *****************************************************/
 
@@ -100,6 +102,28 @@ LOCKBIT = 0xFF (valid)
 #include "mcu_sleep_class.h"
 #endif
 
+#ifndef _TIMEBASE_CLASS_H_
+#include "timebase_class.h"
+#endif
+
+#ifndef _EVENT_TRACE_H_
+#include "event_trace.h"
+#endif
+
+#ifndef _DEFERRED_WORK_H_
+#include "deferred_work.h"
+#endif
+
+#ifndef _PWM_FADE_CLASS_H_
+#include "pwm_fade_class.h"
+#endif
+
+// Button_2 (PD6) and Button_3 (PD5) sit on the Timer0 compare outputs
+//  OC0A/OC0B that HW_PWM hands to LEDs
+#if HW_PWM
+#error "HW_PWM=1 drives PD6/PD5 (OC0A/OC0B), on this board they are buttons 2 and 3"
+#endif
+
 int main(void)
 {
     // Enable MCU sleep
@@ -108,6 +132,11 @@ int main(void)
     // Idle is the default power mode ... but set it anyway.
     mcu_sleep_class::getInstance()->SetSleepMode(mcu_sleep_class::E_MCU_SLEEP_MODE_IDLE);
 
+#if TIMEBASE_IN_USE
+    // Diagnostic builds use Timer0 as a free running timebase
+    timebase_class::Start();
+#endif
+
     // Try to save more power.  Set these pins as input and enable pullup resistor
     mcu_sleep_class::getInstance()->SetInputAndPullupResistor(IOPinDefines::E_PinDef::E_PIN_PD3);
     mcu_sleep_class::getInstance()->SetInputAndPullupResistor(IOPinDefines::E_PinDef::E_PIN_PD4);
@@ -154,28 +183,57 @@ int main(void)
                         ,IOPinDefines::E_PinIntrType::E_PIN_INTR_ANY_EDGE);
     RotaryEncoderButton.Attach(&event_queue);
 
+    // Ended fades
+    pwm_fade_class::pFade->Attach(&event_queue);
+
     // RGB Controller state machine
     rgb_controller_state_machine RGB_Controller(&event_queue);
 
     sei();
 
-    event_element_class anEvent;
+    event_batch batch;
 
     for (;;) 
     {
-        if (event_queue.Dequeue(anEvent))
+        // Drain the queue a batch at a time.  The deferred work of the
+        //  ISRs runs first, it feeds the queue.
+        for (;;)
         {
+            deferred_work::Run();
 
-            // Process events through the 
-            //  RGB Controller state machine
-            RGB_Controller.process(anEvent);
+            if (!event_queue.Dequeue(batch)) break;
 
-        } else {
+            for (uint8_t i = 0; i < batch.count; i++)
+            {
+                event_element_class const &anEvent = batch.event[i];
 
-            // Nothing in the queue ... go to sleep
-            mcu_sleep_class::getInstance()->GoMakeSleepNow();
+#if EVENT_CAPTURE
+                // Log the event before any msg the state machine sends
+                RGB_Controller.capture(anEvent, batch.enqueued[i]);
+#endif
+
+                // Process events through the 
+                //  RGB Controller state machine
+                RGB_Controller.process(anEvent);
 
+#if EVENT_TRACE
+                event_trace::Record(anEvent.get_current_hardware()
+                                   ,batch.enqueued[i]
+                                   ,batch.dequeued);
+#endif
+            }
+        }
+
+        // Nothing in the queue ... go to sleep.  The queues are checked
+        //  again with interrupts disabled, work that came in since the
+        //  last Dequeue is processed first instead of waiting for the
+        //  next interrupt to wake the MCU.
+        cli();
+        if (deferred_work::IsEmpty() && event_queue.IsEmpty())
+        {
+            mcu_sleep_class::getInstance()->GoMakeSleepNow();
         }
+        sei();
     }
 
     return 0;
@@ -40,6 +40,10 @@
 #include "mcu_sleep_class.h"
 #endif
 
+#ifndef _POWER_STATS_H_
+#include "power_stats.h"
+#endif
+
 mcu_sleep_class* mcu_sleep_class::m_pInstance = nullptr;
 
 mcu_sleep_class* mcu_sleep_class::getInstance()
@@ -105,7 +109,16 @@ void mcu_sleep_class::SetInterfaceUsage(E_PowerUsage const &_Interface, E_PowerI
     }
 
     // Set the PRR
+#if POWER_STATS
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        // Charge the time so far to the interfaces powered until now
+        POWER_STATS_ACCOUNT();
+        PRR = _power_reduction_variable;
+    }
+#else
     PRR = _power_reduction_variable;
+#endif
 }
 
 void mcu_sleep_class::GoMakeSleepNow()
@@ -148,13 +161,19 @@ void mcu_sleep_class::GoMakeSleepNow()
     break;
     }
 
-    cli();
+    // Called with interrupts disabled
     sleep_enable();
-    sleep_bod_disable();
 
     // Toggle the status LED if enabled.
     if (_EnableStatusLED) SleepStatusLED.Toggle();
 
+    // From here on the time is charged to the sleep mode
+    POWER_STATS_SLEEP_ENTER(_PowerSleepMode);
+
+    // The BOD stays off only if sleep_cpu() follows within 3 cycles.
+    //  The instruction after sei() runs before any pending interrupt,
+    //  the MCU is asleep before an ISR can add work.
+    sleep_bod_disable();
     sei();
     sleep_cpu();
 
@@ -102,6 +102,9 @@ public:
     void DisableStatusLED();
 
     void SetInterfaceUsage(E_PowerUsage const &_Interface, E_PowerInterfaceInUse const &_InUse);
+
+    // Called with interrupts disabled once the caller found nothing
+    //  to do.  Returns awake with interrupts enabled.
     void GoMakeSleepNow();
 
     // To save power, set unused pins as input and turn on the pull up resistors
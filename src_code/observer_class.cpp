@@ -30,6 +30,14 @@
      When         Who                Description of change
     -----------  ----------         ------------------------
     2014 Oct 05  James Stokebrand   Initial creation.
+    2026 Oct 17  agent              Pin interrupts notify only the
+                                      observers of changed pins.
+    2026 Oct 17  agent              Added the compile time bound
+                                      StaticSubjectPWM/PinIntr.
+    2026 Oct 17  agent              PWM subjects can notify a subset
+                                      of their observers.
+    2026 Oct 17  agent              PWM subject interrupt can be held
+                                      on without observers.
 
 *****************************************************/
 
@@ -121,22 +129,48 @@ void InterruptSubjectPWM::Attach(InterruptObserverPWM* const &A, uint8_t &ID)
     }
 
     // If we have newly attached observers ... enable the interrupt
-    if (ObserverCount==1)
-    {
-        // Disable timer2 power savings
-        mcu_sleep_class::getInstance()->SetInterfaceUsage(
-            mcu_sleep_class::E_TIMER_TWO_INTERFACE,
-            mcu_sleep_class::E_POWER_INTERFACE_DISABLE_POWER_SAVINGS);
+    if ((ObserverCount==1) && !_Held) EnableInterrupt();
+}
+
+void InterruptSubjectPWM::Hold(bool const &A)
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        // The observers keep it enabled otherwise
+        if ((A != _Held) && (ObserverCount == 0))
+        {
+            if (A) EnableInterrupt();
+            else DisableInterrupt();
+        }
+        _Held = A;
+    }
+}
+
+void InterruptSubjectPWM::EnableInterrupt()
+{
+    // Disable timer2 power savings
+    mcu_sleep_class::getInstance()->SetInterfaceUsage(
+        mcu_sleep_class::E_TIMER_TWO_INTERFACE,
+        mcu_sleep_class::E_POWER_INTERFACE_DISABLE_POWER_SAVINGS);
 
-        // Reset counter to zero.
-        TCNT2 = 0;
+    // Reset counter to zero.
+    TCNT2 = 0;
 
-        // Clear interrupt before we enable
-        TIFR2 = (1 << TOV2);
+    // Clear interrupt before we enable
+    TIFR2 = (1 << TOV2);
 
-        // Enable timer interrupt
-        *(_TimerEnableReg) |= (1<<_TimerEnablePin);
-    }
+    // Enable timer interrupt
+    *(_TimerEnableReg) |= (1<<_TimerEnablePin);
+}
+
+void InterruptSubjectPWM::DisableInterrupt()
+{
+    // Disable the timer interrupt
+    *(_TimerEnableReg) &= ~(1<<_TimerEnablePin);
+
+    // ENABLE timer2 power savings interface
+    mcu_sleep_class::getInstance()->SetInterfaceUsage(
+        mcu_sleep_class::E_TIMER_TWO_INTERFACE,
+        mcu_sleep_class::E_POWER_INTERFACE_ENABLE_POWER_SAVINGS);
 }
 
 void InterruptSubjectPWM::Detach(uint8_t const &ID)
@@ -152,16 +186,7 @@ void InterruptSubjectPWM::Detach(uint8_t const &ID)
         ObserverCount--;
 
         // No observers?  Then disable the timer interrupt
-        if (ObserverCount==0) 
-        {
-            // Disable the timer interrupt
-            *(_TimerEnableReg) &= ~(1<<_TimerEnablePin);
-
-            // ENABLE timer2 power savings interface
-            mcu_sleep_class::getInstance()->SetInterfaceUsage(
-                mcu_sleep_class::E_TIMER_TWO_INTERFACE,
-                mcu_sleep_class::E_POWER_INTERFACE_ENABLE_POWER_SAVINGS);
-        }
+        if ((ObserverCount==0) && !_Held) DisableInterrupt();
     }
 }
 
@@ -174,6 +199,16 @@ void InterruptSubjectPWM::Notify(uint8_t const &_Pwm)
     }
 }
 
+void InterruptSubjectPWM::NotifyMask(uint8_t const &_Pwm, uint8_t const &Mask)
+{
+    uint8_t slots = Mask;
+
+    for (uint8_t jj=0; slots; jj++, slots >>= 1)
+    {
+        if ((slots & 1) && _Observer[jj]) _Observer[jj]->Update(_Pwm);
+    }
+}
+
 void InterruptSubjectPWM::InitObservers()
 {
     // Set them all to nullptr.
@@ -184,6 +219,7 @@ void InterruptSubjectPWM::InitObservers()
         }
 
         ObserverCount=0;
+        _Held=false;
     }
 }
 
@@ -195,9 +231,12 @@ void InterruptSubjectPWM::InitObservers()
 // ##############################
 InterruptSubjectPinIntr::InterruptSubjectPinIntr(
  volatile uint8_t* PinMaskIntrReg
-,uint8_t PinChangeIntrEnableBit)
+,uint8_t PinChangeIntrEnableBit
+,volatile uint8_t* PinReg)
 :_PinMaskIntrReg(PinMaskIntrReg)
 ,_PinChangeIntrEnableBit(PinChangeIntrEnableBit)
+,_PinReg(PinReg)
+,_Pins(*PinReg)
 {
     InitObservers();
 }
@@ -215,6 +254,10 @@ void InterruptSubjectPinIntr::Attach(InterruptObserver* const &A,uint8_t const &
         // Observer was empty.  Increment the ObserverCount.
         if (empty_observer) ObserverCount++;
 
+        // Start from the current levels, the observer compares the
+        //  next snapshot against them
+        _Pins = *_PinReg;
+
         // Enable the specific pin interrupt
         *(_PinMaskIntrReg) |= (1<<Bit);
 
@@ -248,12 +291,23 @@ void InterruptSubjectPinIntr::Detach(uint8_t const &Bit)
     }
 }
 
-void InterruptSubjectPinIntr::Notify()
+uint8_t InterruptSubjectPinIntr::Changed(uint8_t const &Pins)
 {
-    // Notify observers of an interrupt event
-    for (uint8_t jj=0; jj<_NumberOfObservers; jj++)
+    // Pins that changed since the last snapshot.  The other
+    //  observers have nothing new to read, dont call them.
+    uint8_t changed = (_Pins ^ Pins) & *(_PinMaskIntrReg);
+    _Pins = Pins;
+    return changed;
+}
+
+void InterruptSubjectPinIntr::Notify(uint8_t const &Pins)
+{
+    uint8_t changed = Changed(Pins);
+
+    // Notify the observers of the changed pins
+    for (uint8_t jj=0; changed; jj++, changed >>= 1)
     {
-        if (_Observers[jj]) _Observers[jj]->Update();
+        if ((changed & 1) && _Observers[jj]) _Observers[jj]->Update();
     }
 }
 
@@ -33,10 +33,19 @@
      When         Who                Description of change
     -----------  ----------         ------------------------
     2014 Oct 05  James Stokebrand   Initial creation.
+    2026 Oct 17  agent              Pin interrupts notify only the
+                                      observers of changed pins.
+    2026 Oct 17  agent              Added the compile time bound
+                                      StaticSubjectPWM/PinIntr.
+    2026 Oct 17  agent              PWM subjects can notify a subset
+                                      of their observers.
+    2026 Oct 17  agent              Six PWM observers.
+    2026 Oct 17  agent              PWM subject Hold().
 
 *****************************************************/
 
 #include <avr/io.h>
+#include <util/atomic.h>
 
 #ifndef _EVENT_LISTING_H_
 #include "event_listing.h"
@@ -45,7 +54,9 @@
 
 static const uint8_t DEFAULT_NUMBER_OF_PIN_INTERRUPT_OBSERVERS = 8;
 
-static const uint8_t DEFAULT_NUMBER_OF_PWM_INTERRUPT_OBSERVERS = 3;
+// One per LED of the six LED display.  NOTE: 8 max, the PWM engines
+//  keep the slots in a uint8_t mask.
+static const uint8_t DEFAULT_NUMBER_OF_PWM_INTERRUPT_OBSERVERS = 6;
 
 
 class EventObserver
@@ -92,6 +103,12 @@ public:
     virtual void Attach(InterruptObserverPWM* const &A, uint8_t &ID);
     virtual void Detach(uint8_t const &ID);
     virtual void Notify(uint8_t const &_Pwm);
+
+    // Notify only the observers of the slots (IDs) set in Mask
+    void NotifyMask(uint8_t const &_Pwm, uint8_t const &Mask);
+
+    // Keep the interrupt enabled without observers (true) or not
+    void Hold(bool const &A);
 protected:
     InterruptSubjectPWM(
          volatile uint8_t* TimerEnableReg
@@ -102,12 +119,16 @@ protected:
         InitObservers();
     }
 
+    const static uint8_t _NumberOfObservers = DEFAULT_NUMBER_OF_PWM_INTERRUPT_OBSERVERS;
+    InterruptObserverPWM *_Observer[_NumberOfObservers];
+
 private:
     void InitObservers();
+    void EnableInterrupt();
+    void DisableInterrupt();
 
-    const static uint8_t _NumberOfObservers = DEFAULT_NUMBER_OF_PWM_INTERRUPT_OBSERVERS;
-    InterruptObserverPWM *_Observer[_NumberOfObservers];
     uint8_t ObserverCount;
+    bool _Held;
 
     volatile uint8_t* _TimerEnableReg;
     uint8_t           _TimerEnablePin;
@@ -132,24 +153,195 @@ public:
     }
     virtual void Attach(InterruptObserver* const &A, uint8_t const &Bit=0);
     virtual void Detach(uint8_t const &Bit=0);
-    virtual void Notify();
+
+    // Pins is the PINx snapshot taken by the ISR.  Only the
+    //  observers of the pins that differ from the last snapshot
+    //  are updated.
+    virtual void Notify(uint8_t const &Pins);
+
+    // Level of a pin in the snapshot being notified
+    bool Level(uint8_t const &Bit) const
+    {
+        return (_Pins & (1 << Bit)) ? true : false;
+    }
 
 protected:
-    InterruptSubjectPinIntr(volatile uint8_t* PinMaskIntrReg,uint8_t PinChangeIntrEnableBit);
+    InterruptSubjectPinIntr(volatile uint8_t* PinMaskIntrReg
+                           ,uint8_t PinChangeIntrEnableBit
+                           ,volatile uint8_t* PinReg);
+
+    // Stores the snapshot, returns the observed pins it changed
+    uint8_t Changed(uint8_t const &Pins);
 
-private:
     // NOTE: Can have 8 pins max on each interrupt.
     const static uint8_t _NumberOfObservers = DEFAULT_NUMBER_OF_PIN_INTERRUPT_OBSERVERS;
     InterruptObserver *_Observers[_NumberOfObservers];
+
+private:
     uint8_t ObserverCount;
 
     volatile uint8_t* _PinMaskIntrReg;
     uint8_t _PinChangeIntrEnableBit;
+    volatile uint8_t* _PinReg;
+    uint8_t _Pins;
 
     void InitObservers(); 
 };
 
 
+// ######## Compile time binding
+//  The subjects above call Update() through the vtable of the
+//  observer.  The Static subjects below list every observer type of
+//  the vector as template arguments instead.  Each slot remembers the
+//  type index of its observer and Notify() calls Type::Update()
+//  directly, the compiler can inline it into the ISR.  Attach/Detach
+//  still work at run time, an observer type missing from the list
+//  does not compile.
+
+// Index of O in Observers
+template <typename O, typename... Observers> struct StaticIndex;
+
+template <typename O, typename... Rest>
+struct StaticIndex<O, O, Rest...>
+{
+    static const uint8_t value = 0;
+};
+
+template <typename O, typename T, typename... Rest>
+struct StaticIndex<O, T, Rest...>
+{
+    static const uint8_t value = 1 + StaticIndex<O, Rest...>::value;
+};
+
+// Calls Update() of the observer of type index Type
+template <typename Base, typename... Observers> struct StaticDispatch;
+
+template <typename Base, typename T>
+struct StaticDispatch<Base, T>
+{
+    template <typename... Args>
+    static inline void Update(uint8_t const &, Base* const &A, Args const &... B)
+    {
+        static_cast<T*>(A)->T::Update(B...);
+    }
+};
+
+template <typename Base, typename T, typename... Rest>
+struct StaticDispatch<Base, T, Rest...>
+{
+    template <typename... Args>
+    static inline void Update(uint8_t const &Type, Base* const &A, Args const &... B)
+    {
+        if (Type == 0) static_cast<T*>(A)->T::Update(B...);
+        else StaticDispatch<Base, Rest...>::Update(Type - 1, A, B...);
+    }
+};
+
+template <typename... Observers>
+class StaticSubjectPWM
+: public InterruptSubjectPWM
+{
+public:
+    virtual ~StaticSubjectPWM() {}
+
+    template <typename O>
+    void Attach(O* const &A, uint8_t &ID)
+    {
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+            InterruptSubjectPWM::Attach(A, ID);
+            if (ID < _NumberOfObservers) _Type[ID] = StaticIndex<O, Observers...>::value;
+        }
+    }
+
+    void Notify(uint8_t const &_Pwm);
+    void NotifyMask(uint8_t const &_Pwm, uint8_t const &Mask);
+
+protected:
+    StaticSubjectPWM(
+         volatile uint8_t* TimerEnableReg
+        ,uint8_t TimerEnablePin)
+    : InterruptSubjectPWM(TimerEnableReg, TimerEnablePin)
+    {}
+
+private:
+    uint8_t _Type[_NumberOfObservers];
+};
+
+template <typename... Observers>
+class StaticSubjectPinIntr
+: public InterruptSubjectPinIntr
+{
+public:
+    virtual ~StaticSubjectPinIntr() {}
+
+    template <typename O>
+    void Attach(O* const &A, uint8_t const &Bit=0)
+    {
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+            _Type[Bit] = StaticIndex<O, Observers...>::value;
+            InterruptSubjectPinIntr::Attach(A, Bit);
+        }
+    }
+
+    void Notify(uint8_t const &Pins);
+
+protected:
+    StaticSubjectPinIntr(volatile uint8_t* PinMaskIntrReg
+                        ,uint8_t PinChangeIntrEnableBit
+                        ,volatile uint8_t* PinReg)
+    : InterruptSubjectPinIntr(PinMaskIntrReg, PinChangeIntrEnableBit, PinReg)
+    {}
+
+private:
+    uint8_t _Type[_NumberOfObservers];
+};
+
+// Notify() needs the complete observer types.  The HAL instantiates
+//  it once where they are known (see hal_interrupts.cpp).
+template <typename... Observers>
+void StaticSubjectPWM<Observers...>::Notify(uint8_t const &_Pwm)
+{
+    for (uint8_t jj=0; jj<_NumberOfObservers; jj++)
+    {
+        if (_Observer[jj])
+        {
+            StaticDispatch<InterruptObserverPWM, Observers...>::Update(
+                _Type[jj], _Observer[jj], _Pwm);
+        }
+    }
+}
+
+template <typename... Observers>
+void StaticSubjectPWM<Observers...>::NotifyMask(uint8_t const &_Pwm, uint8_t const &Mask)
+{
+    uint8_t slots = Mask;
+
+    for (uint8_t jj=0; slots; jj++, slots >>= 1)
+    {
+        if ((slots & 1) && _Observer[jj])
+        {
+            StaticDispatch<InterruptObserverPWM, Observers...>::Update(
+                _Type[jj], _Observer[jj], _Pwm);
+        }
+    }
+}
+
+template <typename... Observers>
+void StaticSubjectPinIntr<Observers...>::Notify(uint8_t const &Pins)
+{
+    uint8_t changed = Changed(Pins);
+
+    for (uint8_t jj=0; changed; jj++, changed >>= 1)
+    {
+        if ((changed & 1) && _Observers[jj])
+        {
+            StaticDispatch<InterruptObserver, Observers...>::Update(
+                _Type[jj], _Observers[jj]);
+        }
+    }
+}
+
+
 // ######## SPI
 class InterruptObserverSPI
 {
@@ -0,0 +1,143 @@
+/****************************************************
+    Power Statistics
+
+    File:   power_stats.cpp
+    Author: agent
+    agent AT local
+
+    power_stats.cpp file is part of the RGB LED Controller and Node 
+     version 1 hardware project.
+
+    This file contains the power state accounting of the firmware.
+     See power_stats.h.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+
+*****************************************************/
+
+#ifndef _POWER_STATS_H_
+#include "power_stats.h"
+#endif
+
+#ifndef _COMM_CLASS_H_
+#include "comm_class.h"
+#endif
+
+#if POWER_STATS
+
+// PRR bits with an interface behind them (bit 4 is reserved)
+#define PRR_INTERFACES ((1 << PRTWI) | (1 << PRTIM2) | (1 << PRTIM0) | (1 << PRTIM1) \
+                      | (1 << PRSPI) | (1 << PRUSART0) | (1 << PRADC))
+
+const uint8_t power_stats::E_BIN_AWAKE;
+const uint8_t power_stats::NUMBER_OF_BINS;
+const uint8_t power_stats::E_WAKE_TIMEBASE;
+const uint8_t power_stats::NUMBER_OF_WAKE_SOURCES;
+
+uint32_t power_stats::_Residency[NUMBER_OF_BINS];
+uint32_t power_stats::_PrrOn[8];
+uint16_t power_stats::_Wakes[NUMBER_OF_WAKE_SOURCES];
+uint16_t power_stats::_Last = 0;
+uint8_t power_stats::_Bin = E_BIN_AWAKE;
+volatile bool power_stats::_Sleeping = false;
+
+void power_stats::Account()
+{
+    uint16_t const now = timebase_class::NowFromIsr();
+    uint16_t const elapsed = now - _Last;
+    _Last = now;
+
+    _Residency[_Bin] += elapsed;
+
+    // A cleared PRR bit is a powered interface
+    uint8_t const powered = ~PRR & PRR_INTERFACES;
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        if (powered & (1 << i)) _PrrOn[i] += elapsed;
+    }
+}
+
+void power_stats::Clear()
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        Account();
+        for (uint8_t i = 0; i < NUMBER_OF_BINS; i++) _Residency[i] = 0;
+        for (uint8_t i = 0; i < 8; i++) _PrrOn[i] = 0;
+        for (uint8_t i = 0; i < NUMBER_OF_WAKE_SOURCES; i++) _Wakes[i] = 0;
+    }
+}
+
+void power_stats::Report(comm_class &aComm, bool const &clear)
+{
+    uint8_t prescale_log2 = 0;
+    while ((1UL << prescale_log2) < TIMEBASE_PRESCALE) prescale_log2++;
+
+    // Bring the totals up to date
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        Account();
+    }
+
+    aComm.report_data(prescale_log2);
+    aComm.report_data(NUMBER_OF_BINS);
+    for (uint8_t i = 0; i < NUMBER_OF_BINS; i++)
+    {
+        uint32_t ticks;
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+        {
+            ticks = _Residency[i];
+        }
+        aComm.report_data32(ticks);
+    }
+
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        uint32_t ticks;
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+        {
+            ticks = _PrrOn[i];
+        }
+        aComm.report_data32(ticks);
+    }
+
+    aComm.report_data(NUMBER_OF_WAKE_SOURCES);
+    for (uint8_t i = 0; i < NUMBER_OF_WAKE_SOURCES; i++)
+    {
+        uint16_t wakes;
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+        {
+            wakes = _Wakes[i];
+        }
+        aComm.report_data16(wakes);
+    }
+
+    if (clear) Clear();
+}
+
+#else
+
+void power_stats::Report(comm_class &, bool const &)
+{
+    // Not built in ... empty report.
+}
+
+#endif
@@ -0,0 +1,142 @@
+#ifndef _POWER_STATS_H_
+#define _POWER_STATS_H_
+
+/****************************************************
+    Power Statistics
+
+    File:   power_stats.h
+    Author: agent
+    agent AT local
+
+    power_stats.h file is part of the RGB LED Controller and Node 
+     version 1 hardware project.
+
+    This file contains the power state accounting of the firmware
+     (POWER_STATS=1 in the Makefile).  Time is taken from the Timer0
+     timebase (timebase_class.h) and attributed to:
+     - The sleep mode the CPU was in, or awake
+     - Every PRR bit while the interface was powered (bit cleared)
+     and every wake up is counted against the vector that woke the CPU.
+
+    Timer0 only runs in SLEEP_MODE_IDLE and SLEEP_MODE_ADC, the time
+     spent in the deeper modes is not measured.  The timebase overflow
+     wakes the CPU every 256 ticks, it is reported as its own wake
+     source (E_WAKE_TIMEBASE).  A POWER_STATS build runs the timebase
+     at ck/1024 (ck/64 with HW_PWM) unless another diagnostic needs
+     finer ticks, the overflow then wakes the CPU 30 times a second.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+    2026 Oct 17  agent              Coarse timebase in POWER_STATS builds.
+
+*****************************************************/
+
+#include <avr/io.h>
+
+#ifndef _TIMEBASE_CLASS_H_
+#include "timebase_class.h"
+#endif
+
+#ifndef _ISR_PROFILE_H_
+#include "isr_profile.h"
+#endif
+
+#ifndef _MCU_SLEEP_CLASS_H_
+#include "mcu_sleep_class.h"
+#endif
+
+class comm_class;
+
+class power_stats
+{
+public:
+    // Residency bins: the sleep modes, then awake
+    static const uint8_t E_BIN_AWAKE = mcu_sleep_class::E_MCU_SLEEP_MODE_LAST_ENUM;
+    static const uint8_t NUMBER_OF_BINS = E_BIN_AWAKE + 1;
+
+    // Wake sources: the profiled vectors, then the timebase
+    static const uint8_t E_WAKE_TIMEBASE = isr_profile::E_ISR_LAST_VECTOR;
+    static const uint8_t NUMBER_OF_WAKE_SOURCES = E_WAKE_TIMEBASE + 1;
+
+    // Called with interrupts disabled right before sleep_cpu()
+    static void SleepEnter(mcu_sleep_class::E_PowerSleepMode const A)
+    {
+        Account();
+        _Bin = A;
+        _Sleeping = true;
+    }
+
+    // Called at the start of every ISR.  The first one after
+    //  SleepEnter() is the wake source.
+    static inline void Wake(uint8_t const &A) __attribute__((always_inline))
+    {
+        if (!_Sleeping) return;
+        _Sleeping = false;
+        Account();
+        _Bin = E_BIN_AWAKE;
+        if (_Wakes[A] != 0xFFFF) _Wakes[A]++;
+    }
+
+    // Called with interrupts disabled before the PRR is written.
+    //  The timebase ISR calls it too so that no interval outlasts
+    //  the 16 bit timebase.
+    static void Account();
+
+    /*
+        Report format (E_REPORT_POWER_STATS):
+            TIMEBASE_PRESCALE log2 (1 byte) - cycles per tick = 1 << value
+            Number of bins      (1 byte)
+            Per bin (E_PowerSleepMode order, awake last):
+                Ticks            (4 bytes, little endian)
+            Per PRR bit 0..7:
+                Ticks powered    (4 bytes, little endian)
+            Number of wake sources (1 byte)
+            Per wake source (E_IsrVector order, timebase last):
+                Wake ups         (2 bytes, little endian)
+    */
+    static void Report(comm_class &aComm, bool const &clear);
+
+private:
+    power_stats();
+
+    static void Clear();
+
+    static uint32_t _Residency[NUMBER_OF_BINS];
+    static uint32_t _PrrOn[8];
+    static uint16_t _Wakes[NUMBER_OF_WAKE_SOURCES];
+    static uint16_t _Last;
+    static uint8_t _Bin;
+    static volatile bool _Sleeping;
+};
+
+#if POWER_STATS
+#define POWER_STATS_WAKE(A)         power_stats::Wake(isr_profile::A)
+#define POWER_STATS_SLEEP_ENTER(A)  power_stats::SleepEnter(A)
+#define POWER_STATS_ACCOUNT()       power_stats::Account()
+#define POWER_STATS_TIMEBASE()      do { power_stats::Wake(power_stats::E_WAKE_TIMEBASE); \
+                                         power_stats::Account(); } while (0)
+#else
+#define POWER_STATS_WAKE(A)
+#define POWER_STATS_SLEEP_ENTER(A)
+#define POWER_STATS_ACCOUNT()
+#define POWER_STATS_TIMEBASE()
+#endif
+
+#endif
@@ -39,10 +39,20 @@
      When         Who                Description of change
     -----------  ----------         ------------------------
     2014 Oct 05  James Stokebrand   Initial Creation
+    2026 Oct 17  agent              Duty values feed the edge
+                                     scheduled PWM engine.
+    2026 Oct 17  agent              Pins feed the port grouped
+                                     PWM engine.
+    2026 Oct 17  agent              And the BAM PWM engine.
+    2026 Oct 17  agent              Gamma corrected duty values.
+    2026 Oct 17  agent              Pins with a free compare unit
+                                     use hardware PWM.
+    2026 Oct 17  agent              Fade engine hooks.
 
 *****************************************************/
 
 #include <util/atomic.h>
+#include <avr/pgmspace.h>
 
 #ifndef _PWM_CLASS_H_
 #include "pwm_class.h"
@@ -52,10 +62,74 @@
 // Timer2 interrupt object instance
 TIMER2_interrupt_subject aTIMER2_Inter;
 
+#if PWM_GAMMA
+// Duty of each brightness level: gamma 2.2, 12 bits (8 bit step and
+//  4 bits of fraction).  The first levels are one fraction apart so
+//  no two levels give the same duty.
+static_assert(PWM_DITHER_BITS <= 4, "The gamma table has 4 fraction bits");
+
+static const uint16_t pwm_gamma[256] PROGMEM =
+{
+       0,    1,    2,    3,    4,    5,    6,    7,
+       8,    9,   10,   11,   12,   13,   14,   15,
+      16,   17,   18,   19,   20,   21,   22,   23,
+      24,   25,   27,   29,   32,   34,   37,   40,
+      42,   45,   48,   52,   55,   58,   62,   66,
+      69,   73,   77,   81,   85,   90,   94,   99,
+     104,  108,  113,  118,  123,  129,  134,  140,
+     145,  151,  157,  163,  169,  175,  182,  188,
+     195,  202,  209,  216,  223,  230,  237,  245,
+     253,  260,  268,  276,  284,  293,  301,  310,
+     318,  327,  336,  345,  355,  364,  373,  383,
+     393,  403,  413,  423,  433,  444,  454,  465,
+     476,  487,  498,  509,  520,  532,  543,  555,
+     567,  579,  591,  604,  616,  629,  642,  655,
+     668,  681,  694,  708,  721,  735,  749,  763,
+     777,  791,  806,  820,  835,  850,  865,  880,
+     896,  911,  927,  942,  958,  974,  991, 1007,
+    1023, 1040, 1057, 1074, 1091, 1108, 1125, 1143,
+    1161, 1178, 1196, 1214, 1233, 1251, 1270, 1288,
+    1307, 1326, 1345, 1365, 1384, 1404, 1423, 1443,
+    1463, 1484, 1504, 1524, 1545, 1566, 1587, 1608,
+    1629, 1651, 1672, 1694, 1716, 1738, 1760, 1782,
+    1805, 1827, 1850, 1873, 1896, 1919, 1943, 1966,
+    1990, 2014, 2038, 2062, 2087, 2111, 2136, 2160,
+    2185, 2211, 2236, 2261, 2287, 2313, 2338, 2365,
+    2391, 2417, 2444, 2470, 2497, 2524, 2551, 2579,
+    2606, 2634, 2662, 2690, 2718, 2746, 2774, 2803,
+    2832, 2861, 2890, 2919, 2949, 2978, 3008, 3038,
+    3068, 3098, 3128, 3159, 3190, 3220, 3251, 3283,
+    3314, 3345, 3377, 3409, 3441, 3473, 3505, 3538,
+    3571, 3603, 3636, 3669, 3703, 3736, 3770, 3804,
+    3838, 3872, 3906, 3941, 3975, 4010, 4045, 4080
+};
+#endif
+
+// Engine duty of the brightness level A
+static inline pwm_duty_t pwm_duty(uint8_t const &A)
+{
+#if PWM_GAMMA
+    // Keep the fraction bits the engine dithers
+    pwm_duty_t const duty = pgm_read_word(&pwm_gamma[A]) >> (4 - PWM_DITHER_BITS);
+    return (duty || (A == 0)) ? duty : 1;
+#else
+    return (pwm_duty_t)A << PWM_DITHER_BITS;
+#endif
+}
+
+// Hardware PWM duty of the brightness level A, 1 at the least
+static inline uint8_t pwm_hw_step(uint8_t const &A)
+{
+    uint8_t const step = pwm_duty(A) >> PWM_DITHER_BITS;
+    return step ? step : 1;
+}
+
 pwm_class::pwm_class(IOPinDefines::E_PinDef const &A
     , bool const &CommonCathode
     , uint8_t const &StartValue)
 : _ObserverID(0xFF)
+, _CommonCathode(CommonCathode)
+, _HwChannel(hw_pwm_class::Allocate(A, !CommonCathode))
 {
 
     if (CommonCathode) 
@@ -93,10 +167,62 @@ void pwm_class::setValue(uint8_t const &A)
     } 
 #endif
 
+    Engage(A);
+}
+
+void pwm_class::Engage(uint8_t const &A)
+{
+    if (_HwChannel != hw_pwm_class::E_HW_PWM_NONE)
+    {
+        // The compare unit of the pin drives it, no ISR
+        hw_pwm_class::SetDuty(_HwChannel, pwm_hw_step(A));
+        return;
+    }
+
+#if PWM_ENGINE != PWM_ENGINE_TICK
+    // Value is somewhere inbetween top and bottom ...
+    //  The engine takes the duty at the next frame start
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        if (_ObserverID == 0xFF) {
+            _Subject->Attach(this,_ObserverID);
+#if (PWM_ENGINE == PWM_ENGINE_PORT) || (PWM_ENGINE == PWM_ENGINE_BAM)
+            _Subject->SetPin(_ObserverID, _LED->_PortReg, _LED->_Bit, !_CommonCathode);
+#endif
+        }
+        _Subject->SetDuty(_ObserverID, pwm_duty(A));
+    }
+#else
     // Value is somewhere inbetween top and bottom ...
     if (_ObserverID == 0xFF) {
         _Subject->Attach(this,_ObserverID);
     }
+#endif
+}
+
+void pwm_class::fadeStart()
+{
+    uint8_t value;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        value = _PwmValue;
+    }
+
+    // Stay in the PWM engine for the ramp, also at 0 and 0xFF
+    Engage(value);
+}
+
+void pwm_class::fadeValue(uint8_t const &A)
+{
+    _PwmValue = A;
+
+    if (_HwChannel != hw_pwm_class::E_HW_PWM_NONE)
+    {
+        hw_pwm_class::SetDuty(_HwChannel, pwm_hw_step(A));
+        return;
+    }
+
+#if PWM_ENGINE != PWM_ENGINE_TICK
+    _Subject->SetDuty(_ObserverID, pwm_duty(A));
+#endif
 }
 
 void pwm_class::setPercent(uint8_t const &A)
@@ -112,6 +238,8 @@ void pwm_class::On()
 
     // Detach first to stop updates
     _Subject->Detach(_ObserverID);
+    // Hand a hardware PWM pin back to the port
+    hw_pwm_class::Disconnect(_HwChannel);
     // Turn the LED ON
     _LED->On();
     // Set observer ID to detached
@@ -125,6 +253,8 @@ void pwm_class::Off()
 
     // Detach first to stop updates
     _Subject->Detach(_ObserverID);
+    // Hand a hardware PWM pin back to the port
+    hw_pwm_class::Disconnect(_HwChannel);
     // Turn the LED OFF
     _LED->Off();
     // Set observer ID to detached
@@ -147,18 +277,4 @@ void pwm_class::Toggle()
     }
 }
 
-// Update is called from the Timer ISR
-void pwm_class::Update(uint8_t const &_Pwm)
-{
-    if (_PwmValue <= _Pwm)
-    {
-        _LED->Off();
-    }
-    else 
-    {
-        // Turn the pin on
-        _LED->On();
-    }
-}
-
 
@@ -42,6 +42,11 @@
      When         Who                Description of change
     -----------  ----------         ------------------------
     2014 Oct 05  James Stokebrand   Initial Creation
+    2026 Oct 17  agent              Update() inline, reachable from
+                                     the static Timer2 subject.
+    2026 Oct 17  agent              Remembers the LED polarity.
+    2026 Oct 17  agent              Hardware PWM channel.
+    2026 Oct 17  agent              Fade engine hooks.
 
 *****************************************************/
 
@@ -53,6 +58,10 @@
 #include "hal_interrupts.h"
 #endif
 
+#ifndef _HW_PWM_CLASS_H_
+#include "hw_pwm_class.h"
+#endif
+
 class pwm_class
 : public InterruptObserverPWM
 {
@@ -72,12 +81,38 @@ public:
         return _PwmValue;
     }
 
+    // Fade engine (pwm_fade_class).  fadeStart() keeps the LED in its
+    //  PWM engine for the ramp, also at 0 and 0xFF.  fadeValue() is
+    //  called from the Timer2 ISR once per frame.
+    void fadeStart();
+    void fadeValue(uint8_t const &A);
+
 protected:
-    void Update(uint8_t const &_Pwm);
+    // The static Timer2 subject calls pwm_class::Update() directly
+    template <typename, typename...> friend struct StaticDispatch;
+
+    // Update is called from the Timer ISR
+    void Update(uint8_t const &_Pwm)
+    {
+        if (_PwmValue <= _Pwm)
+        {
+            _LED->Off();
+        }
+        else 
+        {
+            // Turn the pin on
+            _LED->On();
+        }
+    }
 
 private:
+    // Run the LED in hardware or software PWM at value A
+    void Engage(uint8_t const &A);
+
     volatile uint8_t _PwmValue;
     uint8_t _ObserverID;
+    bool _CommonCathode;
+    uint8_t _HwChannel;
     OutputPinClass *_LED;
 
     TIMER2_interrupt_subject* _Subject;
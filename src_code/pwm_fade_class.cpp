@@ -0,0 +1,214 @@
+/****************************************************
+    PWM Fade Class
+
+    File:   pwm_fade_class.cpp
+    Author: agent
+    agent AT local
+
+    pwm_fade_class.cpp file is part of the RGB LED Controller and Node
+     version 1 hardware project.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+    2026 Oct 17  agent              Completions lost to a full
+                                      deferred work queue are counted.
+    2026 Oct 17  agent              A ramp whose completion is dropped
+                                      still ends on setValue().
+
+*****************************************************/
+
+#include <util/atomic.h>
+
+#ifndef _PWM_FADE_CLASS_H_
+#include "pwm_fade_class.h"
+#endif
+
+#ifndef _HAL_INTERRUPTS_H_
+#include "hal_interrupts.h"
+#endif
+
+#ifndef _DEFERRED_WORK_H_
+#include "deferred_work.h"
+#endif
+
+static_assert(PWM_FADE_SLOTS <= 8, "The active slots are a byte mask");
+
+pwm_fade_class* pwm_fade_class::pFade = 0;
+
+pwm_fade_class::pwm_fade_class(E_InputHardware const &A)
+: event_element_class(A)
+, _Active(0)
+, _Dropped(0)
+{
+    pFade = this;
+
+    for (uint8_t ss=0; ss<PWM_FADE_SLOTS; ss++)
+    {
+        _Slot[ss]._LED = nullptr;
+        _Slot[ss]._Frames = 0;
+    }
+
+    temp.clear();
+
+    deferred_work::Register(deferred_work::E_WORK_PWM_FADE, &pwm_fade_class::Complete);
+}
+
+bool pwm_fade_class::start(pwm_class* const &A
+                          ,uint8_t const &Target
+                          ,uint16_t const &msecs
+                          ,uint8_t const &ID)
+{
+    if (A == nullptr) return false;
+
+    // The running ramp of the LED, else a free slot
+    uint8_t slot = PWM_FADE_SLOTS;
+    for (uint8_t ss=0; ss<PWM_FADE_SLOTS; ss++)
+    {
+        if (_Slot[ss]._LED == A) { slot = ss; break; }
+        if ((_Slot[ss]._LED == nullptr) && (slot == PWM_FADE_SLOTS)) slot = ss;
+    }
+    if (slot == PWM_FADE_SLOTS) return false;
+
+    // PWM frames in the ramp, the last one lands on the target
+    uint32_t frames = ((uint32_t)msecs * (F_CPU / 1000UL)) / PWM_FRAME_CYCLES;
+    if (frames == 0) frames = 1;
+    if (frames > 0xFFFF) frames = 0xFFFF;
+
+    uint8_t const value = A->getValue();
+    int32_t const step = ((int32_t)Target - value) * 65536L / (int32_t)frames;
+
+    // In the PWM engine from the first frame on
+    A->fadeStart();
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        fade_slot &fade = _Slot[slot];
+        fade._LED = A;
+        fade._Level = (uint32_t)value << 16;
+        fade._Step = step;
+        fade._Target = Target;
+        fade._ID = ID;
+        fade._Frames = frames;
+
+        // Timer2 frames also step the ramps of hardware PWM LEDs
+        if (_Active == 0) TIMER2_interrupt_subject::pINTR_handler->Hold(true);
+        _Active |= (1 << slot);
+    }
+
+    return true;
+}
+
+void pwm_fade_class::stop(pwm_class* const &A)
+{
+    for (uint8_t ss=0; ss<PWM_FADE_SLOTS; ss++)
+    {
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+            if (_Slot[ss]._LED == A)
+            {
+                _Slot[ss]._LED = nullptr;
+                _Slot[ss]._Frames = 0;
+                _Active &= ~(1 << ss);
+                if (_Active == 0) TIMER2_interrupt_subject::pINTR_handler->Hold(false);
+            }
+        }
+    }
+}
+
+void pwm_fade_class::Frame()
+{
+    uint8_t const active = _Active;
+    if (active == 0) return;
+
+    for (uint8_t ss=0; ss<PWM_FADE_SLOTS; ss++)
+    {
+        if ((active & (1 << ss)) == 0) continue;
+
+        fade_slot &fade = _Slot[ss];
+
+        // Ended, Complete() has not run yet
+        if (fade._Frames == 0) continue;
+
+        if (--fade._Frames == 0)
+        {
+            fade._LED->fadeValue(fade._Target);
+
+            // Queue full ... Complete() runs here but for the
+            //  E_PWM_FADE_COMPLETE event
+            if (!deferred_work::Post(deferred_work::E_WORK_PWM_FADE, ss))
+            {
+                pwm_class *const led = fade._LED;
+
+                if (_Dropped != 0xFFFF) _Dropped++;
+                fade._LED = nullptr;
+                _Active &= ~(1 << ss);
+                if (_Active == 0) TIMER2_interrupt_subject::pINTR_handler->Hold(false);
+
+                // Hands 0x00 and 0xFF back to the port
+                led->setValue(fade._Target);
+            }
+        }
+        else
+        {
+            fade._Level += fade._Step;
+            fade._LED->fadeValue(fade._Level >> 16);
+        }
+    }
+}
+
+uint16_t pwm_fade_class::Dropped()
+{
+    uint16_t dropped;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        dropped = _Dropped;
+    }
+    return dropped;
+}
+
+void pwm_fade_class::Complete(uint8_t const &A)
+{
+    if ((pFade == nullptr) || (A >= PWM_FADE_SLOTS)) return;
+
+    fade_slot &fade = pFade->_Slot[A];
+    pwm_class *led = nullptr;
+    uint8_t target = 0;
+    uint8_t id = 0;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        // Not stopped or started again since the ISR ended it
+        if ((fade._LED != nullptr) && (fade._Frames == 0))
+        {
+            led = fade._LED;
+            target = fade._Target;
+            id = fade._ID;
+            fade._LED = nullptr;
+            pFade->_Active &= ~(1 << A);
+            if (pFade->_Active == 0) TIMER2_interrupt_subject::pINTR_handler->Hold(false);
+        }
+    }
+
+    if (led == nullptr) return;
+
+    // Hands 0x00 and 0xFF back to the port
+    led->setValue(target);
+
+    pFade->temp.set(pFade->get_current_hardware(), E_PWM_FADE_COMPLETE, id);
+    pFade->Notify(pFade->temp);
+}
+
+pwm_fade_class aPWM_Fade;
@@ -0,0 +1,119 @@
+#ifndef _PWM_FADE_CLASS_H_
+#define _PWM_FADE_CLASS_H_
+
+/****************************************************
+    PWM Fade Class
+
+    File:   pwm_fade_class.h
+    Author: agent
+    agent AT local
+
+    pwm_fade_class.h file is part of the RGB LED Controller and Node 
+     version 1 hardware project.
+
+    This file contains the brightness fade engine of pwm_class.
+    - start() gives a LED a target value and a duration.
+    - The Timer2 ISR steps every ramp once per PWM frame, in 8.16
+       fixed point.  No events and no main loop work during a ramp.
+    - The last frame posts deferred work.  The main loop sets the
+       final value and notifies E_PWM_FADE_COMPLETE to the observer
+       (the EventQueue).
+    - A full deferred work queue drops the completion.  The LED is
+       left at the target in the PWM engine, the slot is freed and
+       the drop counted.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+    2026 Oct 17  agent              Completions lost to a full
+                                      deferred work queue are counted.
+
+*****************************************************/
+
+#ifndef _OBSERVER_CLASS_H_
+#include "observer_class.h"
+#endif
+
+#ifndef _EVENT_LISTING_H_
+#include "event_listing.h"
+#endif
+
+#ifndef _PWM_CLASS_H_
+#include "pwm_class.h"
+#endif
+
+// Ramps running at once.  Set in the Makefile.
+#ifndef PWM_FADE_SLOTS
+#define PWM_FADE_SLOTS 6
+#endif
+
+class pwm_fade_class
+: public EventSubject
+, public event_element_class
+{
+public:
+    pwm_fade_class(E_InputHardware const &A = E_InputHardware::E_PWM_FADE_01);
+    virtual ~pwm_fade_class() {}
+
+    // Ramp LED A from its value to Target in msecs.  ID comes back as
+    //  the data of E_PWM_FADE_COMPLETE.  A new ramp of the same LED
+    //  replaces the running one.  False when every slot is busy.
+    //  NOTE: setValue() during a ramp is overwritten, stop() first.
+    bool start(pwm_class* const &A
+              ,uint8_t const &Target
+              ,uint16_t const &msecs
+              ,uint8_t const &ID = 0);
+
+    // Stop the ramp of LED A where it is, without event
+    void stop(pwm_class* const &A);
+
+    // Called in the Timer2 ISR once per PWM frame, after the compare
+    //  of the frame start is set (interrupts enabled)
+    void Frame();
+
+    // Ramps that ended without E_PWM_FADE_COMPLETE (saturates)
+    uint16_t Dropped();
+
+    static pwm_fade_class* pFade;
+
+private:
+    // Deferred from Frame() when a ramp ends
+    static void Complete(uint8_t const &A);
+
+    struct fade_slot {
+        pwm_class *_LED;
+        uint32_t _Level;    // 8.16 fixed point
+        int32_t _Step;      // 8.16 fixed point, per frame
+        uint16_t _Frames;   // Frames to go, 0 = idle or ended
+        uint8_t _Target;
+        uint8_t _ID;
+    };
+
+    fade_slot _Slot[PWM_FADE_SLOTS];
+
+    // Slots ramping (bit per slot)
+    volatile uint8_t _Active;
+
+    // Completions the deferred work queue had no room for
+    volatile uint16_t _Dropped;
+
+    event_element_class temp;
+};
+
+#endif
@@ -0,0 +1,127 @@
+/****************************************************
+    RAM Usage
+
+    File:   ram_usage.cpp
+    Author: agent
+    agent AT local
+
+    ram_usage.cpp file is part of the RGB LED Controller and Node 
+     version 1 hardware project.
+
+    This file contains the RAM budget of the running firmware.
+     See ram_usage.h.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+
+*****************************************************/
+
+#ifndef _RAM_USAGE_H_
+#include "ram_usage.h"
+#endif
+
+#ifndef _COMM_CLASS_H_
+#include "comm_class.h"
+#endif
+
+#define RAM_SIZE (RAMEND - RAMSTART + 1)
+
+#if RAM_USAGE && !defined(HAL_HOST)
+
+// Linker and avr-libc malloc symbols
+extern uint8_t __data_start;
+extern uint8_t __bss_end;
+extern uint8_t __heap_start;
+extern uint8_t *__brkval;
+
+// Paint from the end of .bss up to RAMEND.  Runs before the stack
+//  pointer and __zero_reg__ are set up (.init2), nothing is on the
+//  stack yet and no C code can be used.
+extern "C" void ram_usage_paint(void) __attribute__((naked, used, section(".init1")));
+extern "C" void ram_usage_paint(void)
+{
+    __asm volatile (
+        "    ldi r30, lo8(__heap_start)\n"
+        "    ldi r31, hi8(__heap_start)\n"
+        "    ldi r24, %0\n"
+        "    ldi r25, hi8(%1)\n"
+        "    rjmp 2f\n"
+        "1:  st Z+, r24\n"
+        "2:  cpi r30, lo8(%1)\n"
+        "    cpc r31, r25\n"
+        "    brlo 1b\n"
+        "    breq 1b\n"
+        :
+        : "i" (ram_usage::STACK_CANARY), "i" (RAMEND)
+        : "memory");
+}
+
+static uint16_t heap_top()
+{
+    return __brkval ? (uint16_t)__brkval : (uint16_t)&__heap_start;
+}
+
+uint16_t ram_usage::StaticUsed()
+{
+    return (uint16_t)&__bss_end - (uint16_t)&__data_start;
+}
+
+uint16_t ram_usage::HeapUsed()
+{
+    return heap_top() - (uint16_t)&__heap_start;
+}
+
+uint16_t ram_usage::StackLow()
+{
+    // The scan only reads, the current stack is below RAMEND anyway
+    uint8_t const *p = (uint8_t const *)heap_top();
+    while ((p <= (uint8_t const *)RAMEND) && (*p == STACK_CANARY)) p++;
+    return (uint16_t)p;
+}
+
+uint16_t ram_usage::StackPeak()
+{
+    return RAMEND + 1 - StackLow();
+}
+
+uint16_t ram_usage::Unused()
+{
+    return StackLow() - heap_top();
+}
+
+#else
+
+// Not built in (or host build) ... nothing is measured.
+uint16_t ram_usage::StaticUsed() { return 0; }
+uint16_t ram_usage::HeapUsed() { return 0; }
+uint16_t ram_usage::StackLow() { return RAMEND + 1; }
+uint16_t ram_usage::StackPeak() { return 0; }
+uint16_t ram_usage::Unused() { return 0; }
+
+#endif
+
+void ram_usage::Report(comm_class &aComm)
+{
+    aComm.report_data16(RAM_SIZE);
+    aComm.report_data16(StaticUsed());
+    aComm.report_data16(HeapUsed());
+    aComm.report_data16(StackPeak());
+    aComm.report_data16(Unused());
+}
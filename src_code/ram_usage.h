@@ -0,0 +1,89 @@
+#ifndef _RAM_USAGE_H_
+#define _RAM_USAGE_H_
+
+/****************************************************
+    RAM Usage
+
+    File:   ram_usage.h
+    Author: agent
+    agent AT local
+
+    ram_usage.h file is part of the RGB LED Controller and Node 
+     version 1 hardware project.
+
+    This file contains the RAM budget of the running firmware
+     (RAM_USAGE=1 in the Makefile):
+     - Static usage (.data + .bss)
+     - Heap usage (malloc through new.cpp, top is __brkval)
+     - Deepest stack ever reached.  The free RAM between the heap
+        and the stack is painted with a canary at startup (.init1),
+        the lowest byte no longer holding the canary marks the
+        deepest stack.  Nested ISRs (Timer2 PWM, USART RX -> Notify
+        -> EventQueue::Update) are included.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+
+*****************************************************/
+
+#include <avr/io.h>
+
+#ifndef RAM_USAGE
+#define RAM_USAGE 0
+#endif
+
+class comm_class;
+
+class ram_usage
+{
+public:
+    // Value written into the free RAM at startup
+    static const uint8_t STACK_CANARY = 0xC5;
+
+    // Bytes of .data + .bss
+    static uint16_t StaticUsed();
+
+    // Bytes handed out by malloc
+    static uint16_t HeapUsed();
+
+    // Deepest stack ever reached in bytes (0 when not painted)
+    static uint16_t StackPeak();
+
+    // Bytes between the heap and the deepest stack never touched
+    static uint16_t Unused();
+
+    /*
+        Report format (E_REPORT_RAM_USAGE):
+            RAM size    (2 bytes, little endian)
+            Static      (2 bytes, little endian)
+            Heap        (2 bytes, little endian)
+            Stack peak  (2 bytes, little endian)
+            Unused      (2 bytes, little endian)
+    */
+    static void Report(comm_class &aComm);
+
+private:
+    ram_usage();
+
+    // Lowest address not holding the canary
+    static uint16_t StackLow();
+};
+
+#endif
@@ -34,6 +34,8 @@
      When         Who                Description of change
     -----------  ----------         ------------------------
     2014 Oct 05  James Stokebrand   Initial creation.
+    2026 Oct 17  agent              Rotary encoder steps go out up to
+                                      ROTARY_ENCODER_MSG_STEPS per msg.
 
 *****************************************************/
 
@@ -53,6 +55,26 @@
 #include "pwm_six_display.h"
 #endif
 
+#ifndef _ISR_PROFILE_H_
+#include "isr_profile.h"
+#endif
+
+#ifndef _EVENT_TRACE_H_
+#include "event_trace.h"
+#endif
+
+#ifndef _RAM_USAGE_H_
+#include "ram_usage.h"
+#endif
+
+#ifndef _POWER_STATS_H_
+#include "power_stats.h"
+#endif
+
+#ifndef _DEFERRED_WORK_H_
+#include "deferred_work.h"
+#endif
+
 #define DEBUG 0
 
 #define ABS(a) ((a)<0?-(a):a)
@@ -108,7 +130,65 @@ public:
 
     virtual ~rgb_controller_state_machine() {}
 
+    // Diagnostic report requests are answered in every state,
+    //  everything else goes to the current state.
+    void process(const event_element_class &A)
+    {
+        if ((A.get_current_hardware() == E_RGB_CONTROLLER) &&
+            (A.get_current_event() == E_REPORT_REQUEST))
+        {
+            send_report(A.get_current_data());
+            return;
+        }
+
+        base_state_class::process(A);
+    }
+
+    // Log an event (and its EventQueue stamp) for a later replay
+    void capture(const event_element_class &A, uint16_t const &stamp)
+    {
+        _Comm.capture(A, stamp);
+    }
+
 private:
+#ifdef HAL_HOST
+    // Host replay tool needs the state methods (tools/event_replay.cpp)
+    friend class event_replay;
+#endif
+
+    void send_report(uint8_t const &A)
+    {
+        bool const clear = (A & REPORT_CLEAR_FLAG) ? true : false;
+        uint8_t const report = A & ~REPORT_CLEAR_FLAG;
+
+        _Comm.report_start(report);
+        switch (report)
+        {
+        case E_REPORT_ISR_PROFILE:
+            isr_profile::Report(_Comm, clear);
+        break;
+        case E_REPORT_EVENT_LATENCY:
+            event_trace::Report(_Comm, clear);
+        break;
+        case E_REPORT_RAM_USAGE:
+            // The stack peak can't be cleared, the canary is gone
+            ram_usage::Report(_Comm);
+        break;
+        case E_REPORT_POWER_STATS:
+            power_stats::Report(_Comm, clear);
+        break;
+        case E_REPORT_EVENT_QUEUE:
+            _event_queue->Report(_Comm, clear);
+        break;
+        case E_REPORT_DEFERRED_WORK:
+            deferred_work::Report(_Comm, clear);
+        break;
+        default:
+            // Unknown report ... send it empty
+        break;
+        }
+        _Comm.report_end();
+    }
 
     void STATE_IDLE(event_element_class &A)
     {
@@ -184,10 +264,10 @@ _Comm.encode(A);
             switch(A.get_current_event())
             {
             case E_ROTARY_ENCODER_ROTATED_CW:
-                send_msg(E_RE_CW);
+                send_steps(E_RE_CW, rotary_steps(A));
             break;
             case E_ROTARY_ENCODER_ROTATED_CCW:
-                send_msg(E_RE_CCW);
+                send_steps(E_RE_CCW, rotary_steps(A));
             break;
             case E_BUTTON_IS_PRESSED:
                 send_msg(E_RE_PRESSED);
@@ -315,10 +395,10 @@ _Comm.encode(A);
             switch(A.get_current_event())
             {
             case E_ROTARY_ENCODER_ROTATED_CW:
-                send_msg(E_RE_CW);
+                send_steps(E_RE_CW, rotary_steps(A));
             break;
             case E_ROTARY_ENCODER_ROTATED_CCW:
-                send_msg(E_RE_CCW);
+                send_steps(E_RE_CCW, rotary_steps(A));
             break;
             case E_BUTTON_IS_PRESSED:
                 send_msg(E_RE_PRESSED);
@@ -432,10 +512,10 @@ _Comm.encode(A);
             switch(A.get_current_event())
             {
             case E_ROTARY_ENCODER_ROTATED_CW:
-                send_msg(E_RE_CW);
+                send_steps(E_RE_CW, rotary_steps(A));
             break;
             case E_ROTARY_ENCODER_ROTATED_CCW:
-                send_msg(E_RE_CCW);
+                send_steps(E_RE_CCW, rotary_steps(A));
             break;
             case E_BUTTON_IS_PRESSED:
                 send_msg(E_RE_PRESSED);
@@ -549,10 +629,10 @@ _Comm.encode(A);
             switch(A.get_current_event())
             {
             case E_ROTARY_ENCODER_ROTATED_CW:
-                send_msg(E_RE_CW);
+                send_steps(E_RE_CW, rotary_steps(A));
             break;
             case E_ROTARY_ENCODER_ROTATED_CCW:
-                send_msg(E_RE_CCW);
+                send_steps(E_RE_CCW, rotary_steps(A));
             break;
             case E_BUTTON_IS_PRESSED:
                 send_msg(E_RE_PRESSED);
@@ -651,10 +731,10 @@ _Comm.encode(A);
             switch(A.get_current_event())
             {
             case E_ROTARY_ENCODER_ROTATED_CW:
-                send_msg(E_RE_CW);
+                send_steps(E_RE_CW, rotary_steps(A));
             break;
             case E_ROTARY_ENCODER_ROTATED_CCW:
-                send_msg(E_RE_CCW);
+                send_steps(E_RE_CCW, rotary_steps(A));
             break;
             case E_BUTTON_IS_PRESSED:
                 send_msg(E_RE_PRESSED);
@@ -752,10 +832,10 @@ _Comm.encode(A);
             switch(A.get_current_event())
             {
             case E_ROTARY_ENCODER_ROTATED_CW:
-                send_msg(E_RE_CW);
+                send_steps(E_RE_CW, rotary_steps(A));
             break;
             case E_ROTARY_ENCODER_ROTATED_CCW:
-                send_msg(E_RE_CCW);
+                send_steps(E_RE_CCW, rotary_steps(A));
             break;
             case E_BUTTON_IS_PRESSED:
                 send_msg(E_RE_PRESSED);
@@ -854,10 +934,10 @@ _Comm.encode(A);
             switch(A.get_current_event())
             {
             case E_ROTARY_ENCODER_ROTATED_CW:
-                send_msg(E_RE_CW);
+                send_steps(E_RE_CW, rotary_steps(A));
             break;
             case E_ROTARY_ENCODER_ROTATED_CCW:
-                send_msg(E_RE_CCW);
+                send_steps(E_RE_CCW, rotary_steps(A));
             break;
             case E_BUTTON_IS_PRESSED:
                 send_msg(E_RE_PRESSED);
@@ -954,10 +1034,10 @@ _Comm.encode(A);
             switch(A.get_current_event())
             {
             case E_ROTARY_ENCODER_ROTATED_CW:
-                send_msg(E_RE_CW);
+                send_steps(E_RE_CW, rotary_steps(A));
             break;
             case E_ROTARY_ENCODER_ROTATED_CCW:
-                send_msg(E_RE_CCW);
+                send_steps(E_RE_CCW, rotary_steps(A));
             break;
             case E_BUTTON_IS_PRESSED:
                 send_msg(E_RE_PRESSED);
@@ -1053,10 +1133,10 @@ _Comm.encode(A);
             switch(A.get_current_event())
             {
             case E_ROTARY_ENCODER_ROTATED_CW:
-                _rotary_encoder_count++;
+                _rotary_encoder_count += rotary_steps(A);
             break;
             case E_ROTARY_ENCODER_ROTATED_CCW:
-                _rotary_encoder_count--;
+                _rotary_encoder_count -= rotary_steps(A);
             break;
             case E_BUTTON_IS_PRESSED:
                 // RE Button press and release is the sequence to exit LED_SELECT mode
@@ -1068,7 +1148,8 @@ _Comm.encode(A);
             break;
             }
 
-            if (ABS(_rotary_encoder_count) > ROTARY_ENCODER_COUNT_FOR_ADDRESS_CHANGE)
+            // A merged event can carry the count past more than one change
+            while (ABS(_rotary_encoder_count) > ROTARY_ENCODER_COUNT_FOR_ADDRESS_CHANGE)
             {
                 int16_t temp;
                 if (_rotary_encoder_count > 0)
@@ -1086,7 +1167,7 @@ _Comm.encode(A);
                     }
                 }
                 send_msg(E_SELECT);
-                _rotary_encoder_count=0;
+                rotary_count_used();
                 // Display the current address
                 PwmDisplay.Display(pwm_six_display::E_SixDisplayType::E_SIX_DISPLAY_DOT_IND_015_VALUE, _CURRENT_ADDRESS);
             }
@@ -1140,10 +1221,10 @@ _Comm.encode(A);
             switch(A.get_current_event())
             {
             case E_ROTARY_ENCODER_ROTATED_CW:
-                _rotary_encoder_count++;
+                _rotary_encoder_count += rotary_steps(A);
             break;
             case E_ROTARY_ENCODER_ROTATED_CCW:
-                _rotary_encoder_count--;
+                _rotary_encoder_count -= rotary_steps(A);
             break;
             case E_BUTTON_IS_PRESSED:
                 // RE Button press and release is the sequence to exit LED_SELECT mode
@@ -1155,7 +1236,8 @@ _Comm.encode(A);
             break;
             }
 
-            if (ABS(_rotary_encoder_count) > ROTARY_ENCODER_COUNT_FOR_ADDRESS_CHANGE)
+            // A merged event can carry the count past more than one change
+            while (ABS(_rotary_encoder_count) > ROTARY_ENCODER_COUNT_FOR_ADDRESS_CHANGE)
             {
                 if (_rotary_encoder_count > 0)
                 {
@@ -1189,7 +1271,7 @@ _Comm.encode(A);
                     }
                 }
                 send_msg(E_SELECT);
-                _rotary_encoder_count=0;
+                rotary_count_used();
                 // Display the color model.
                 PwmDisplay.Display(pwm_six_display::E_SixDisplayType::E_SIX_DISPLAY_DOT_IND_015_VALUE, (uint8_t)_colorModel);
             }
@@ -1242,10 +1324,10 @@ _Comm.encode(A);
             switch(A.get_current_event())
             {
             case E_ROTARY_ENCODER_ROTATED_CW:
-                _rotary_encoder_count++;
+                _rotary_encoder_count += rotary_steps(A);
             break;
             case E_ROTARY_ENCODER_ROTATED_CCW:
-                _rotary_encoder_count--;
+                _rotary_encoder_count -= rotary_steps(A);
             break;
             case E_BUTTON_IS_PRESSED:
                 // RE Button press and release is the sequence to exit LED_SELECT mode
@@ -1257,7 +1339,8 @@ _Comm.encode(A);
             break;
             }
 
-            if (ABS(_rotary_encoder_count) > ROTARY_ENCODER_COUNT_FOR_ADDRESS_CHANGE)
+            // A merged event can carry the count past more than one change
+            while (ABS(_rotary_encoder_count) > ROTARY_ENCODER_COUNT_FOR_ADDRESS_CHANGE)
             {
                 if (_rotary_encoder_count > 0) {
                     // Disable the status LED
@@ -1271,7 +1354,7 @@ _Comm.encode(A);
                     mcu_sleep_class::getInstance()->EnableStatusLED(); // Enable the controller's status LED.
                 }
                 send_msg(E_SELECT);
-                _rotary_encoder_count=0;
+                rotary_count_used();
                 // Display the status of the status LED.
                 PwmDisplay.Display(pwm_six_display::E_SixDisplayType::E_SIX_DISPLAY_DOT_IND_015_VALUE, (uint8_t)_statusLED);
             }
@@ -1319,10 +1402,10 @@ _Comm.encode(A);
             switch(A.get_current_event())
             {
             case E_ROTARY_ENCODER_ROTATED_CW:
-                _rotary_encoder_count++;
+                _rotary_encoder_count += rotary_steps(A);
             break;
             case E_ROTARY_ENCODER_ROTATED_CCW:
-                _rotary_encoder_count--;
+                _rotary_encoder_count -= rotary_steps(A);
             break;
             case E_BUTTON_IS_RELEASED:
                 // RE Button press and release is the sequence to exit LED_SELECT mode
@@ -1334,7 +1417,8 @@ _Comm.encode(A);
             break;
             }
 
-            if (ABS(_rotary_encoder_count) > ROTARY_ENCODER_COUNT_FOR_ADDRESS_CHANGE)
+            // A merged event can carry the count past more than one change
+            while (ABS(_rotary_encoder_count) > ROTARY_ENCODER_COUNT_FOR_ADDRESS_CHANGE)
             {
                 int16_t temp;
                 if (_rotary_encoder_count > 0)
@@ -1352,7 +1436,7 @@ _Comm.encode(A);
                     }
                 }
                 send_msg(E_SELECT);
-                _rotary_encoder_count=0;
+                rotary_count_used();
                 // Display the current address
                 PwmDisplay.Display(pwm_six_display::E_SixDisplayType::E_SIX_DISPLAY_DOT_IND_015_VALUE, _CURRENT_ADDRESS);
             }
@@ -1363,12 +1447,48 @@ _Comm.encode(A);
         }
     }
     
+    // Steps of a rotary encoder event (older captures carry 0)
+    static uint8_t rotary_steps(event_element_class const &A)
+    {
+        uint8_t const steps = A.get_current_data();
+        if (steps == 0) return 1;
+        if (steps > ROTARY_ENCODER_MAX_STEPS) return ROTARY_ENCODER_MAX_STEPS;
+        return steps;
+    }
+
+    // The steps past the count of one change carry over to the next
+    void rotary_count_used()
+    {
+        if (_rotary_encoder_count > 0)
+        {
+            _rotary_encoder_count -= ROTARY_ENCODER_COUNT_FOR_ADDRESS_CHANGE + 1;
+        } else {
+            _rotary_encoder_count += ROTARY_ENCODER_COUNT_FOR_ADDRESS_CHANGE + 1;
+        }
+    }
+
+    // E_RE_CW/CCW msgs of up to ROTARY_ENCODER_MSG_STEPS steps each
+    void send_steps(E_InputEvent const &event, uint8_t steps)
+    {
+        while (steps > 0)
+        {
+            uint8_t const count = (steps > ROTARY_ENCODER_MSG_STEPS) ? ROTARY_ENCODER_MSG_STEPS : steps;
+            send_msg(event, RE_MSG_DATA(_CURRENT_ADDRESS, count));
+            steps -= count;
+        }
+    }
+
     void send_msg(E_InputEvent const &event)
+    {
+        send_msg(event, _CURRENT_ADDRESS);
+    }
+
+    void send_msg(E_InputEvent const &event, uint8_t const &data)
     {
         event_element_class _temp;
 
         // Assemble the msg
-        _temp.set(E_RGB_CONTROLLER,event,_CURRENT_ADDRESS);
+        _temp.set(E_RGB_CONTROLLER,event,data);
         // Send via comm
         _Comm.encode(_temp);
     }
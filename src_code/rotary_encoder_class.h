@@ -44,6 +44,12 @@
                                      press can be implemented
                                      with the button class.
 
+    2026 Oct 17  agent              Events carry a step count
+                                     so the EventQueue can merge
+                                     them.
+    2026 Oct 17  agent              Uses the pin snapshot of
+                                     the ISR.
+
 *****************************************************/
 
 #ifndef _EVENT_LISTING_H_
@@ -111,11 +117,13 @@ public:
  
     bool CheckStatus(void)
     {
+        // Pin levels of the pin change being processed
+        bool MSB = buttonA.Sampled(); //MSB = most significant bit
+        bool LSB = buttonB.Sampled(); //LSB = least significant bit
+
         // NOTE only one status should change at a time.
-        if (buttonA.CheckStatus() || buttonB.CheckStatus())
+        if (buttonA.CheckStatus(MSB) || buttonB.CheckStatus(LSB))
         {
-            bool MSB = buttonA.Read(); //MSB = most significant bit
-            bool LSB = buttonB.Read(); //LSB = least significant bit
 
             uint8_t encoded = (MSB << 1) | LSB; //converting the 2 pin value to single number
             uint8_t sum  = (lastEncoded << 2) | encoded; //adding it to the previous encoded value
@@ -143,7 +151,8 @@ public:
         if (CheckStatus())
         {
             // SUCCESS!
-            event_element_class A(get_current_hardware(), get_current_event());
+            // One step, the EventQueue adds up consecutive steps
+            event_element_class A(get_current_hardware(), get_current_event(), 1);
             Notify(A);
         }
     }
@@ -11,8 +11,9 @@
     static_queue.h file is part of the RGB LED Controller and Node 
      version 1 hardware project.
 
-    This file implements statically allocated queue class of 
-     "event_element_class" objects.
+    This file implements a statically allocated queue class template.
+     The element type and the capacity are template parameters, all
+     the sizing is resolved at compile time.
 
     Copyright (C) 2015 - James Stokebrand - 2015 Mar 12
 
@@ -33,51 +34,342 @@
      When         Who                Description of change
     -----------  ----------         ------------------------
     2014 Oct 30 James Stokebrand   Initial creation.
+    2026 Oct 17 agent              Templated on element type and capacity.
+    2026 Oct 17 agent              Enqueue can merge into the newest element.
+    2026 Oct 17 agent              Batch dequeue.
+    2026 Oct 17 agent              Overflow policies.
+    2026 Oct 17 agent              Main loop producers, masked _Tail
+                                     reads of shedding queues.
+    2026 Oct 17 agent              DequeueBatch() masks one element
+                                     at a time.
+    2026 Oct 17 agent              No virtual destructor (no vptr).
 
 *****************************************************/
 
 #include <stdbool.h>
+#include <util/atomic.h>
 
 #ifndef _EVENT_LISTING_H_
 #include "event_listing.h"
 #endif
 
+#ifndef _TIMEBASE_CLASS_H_
+#include "timebase_class.h"
+#endif
+
 namespace STATIC_QUEUE_EVENT_LISTING
 {
 
+// Compile time type selection (no <type_traits> on the AVR)
+template <bool Condition, typename IfTrue, typename IfFalse>
+struct select_type { typedef IfTrue type; };
+
+template <typename IfTrue, typename IfFalse>
+struct select_type<false, IfTrue, IfFalse> { typedef IfFalse type; };
+
+// Keeps the compiler from moving the element copy across the index
+//  update that publishes it to the other side.
+#define STATIC_QUEUE_BARRIER() __asm__ __volatile__ ("" ::: "memory")
+
+// Overflow policies, what a full queue sheds (also set from the Makefile)
+#define QUEUE_DROP_NEWEST 0 // The element being enqueued
+#define QUEUE_DROP_OLDEST 1 // The element next in line
+#define QUEUE_DROP_LOWEST 2 // The oldest of the lowest ranked elements
+
 /*
-    NOTE NOTE NOTE !!! 
-    Due to the use of uint8_t for the front/rear/count variables, the
-    max size of this queue is 255!
+    Single producer / single consumer ring of N elements of type T.
+
+    The producers are the ISRs (Timer1) and the main loop (the
+    deferred work of the pin change and USART RX vectors, fade
+    completions).  Enqueue runs with interrupts masked, so a main loop
+    producer can't be split by an ISR, and AVR ISRs don't nest: the
+    producers act as one and only ever move _Head.  The main loop is
+    the only consumer and moves _Tail.  Both indices are free running
+    counters:
+        elements = _Head - _Tail
+        empty    = _Head == _Tail
+        full     = elements == N
+
+    N must be a power of two.  Up to 128 elements the indices are 8 bit
+    and a single load/store is atomic on the AVR, neither side has to
+    mask interrupts.  Larger queues use 16 bit indices and the consumer
+    reads _Head with interrupts masked.
+
+    POLICY selects what a full queue drops.  QUEUE_DROP_OLDEST and
+    QUEUE_DROP_LOWEST make room by moving _Tail (and the queued
+    elements) from the producer side.  This is safe because every
+    consumer access of those queues is masked too: Dequeue() becomes
+    DequeueLocked(), DequeueBatch() masks each element and Tail()
+    reads a 16 bit _Tail masked.  A copy out of a slot can't be overtaken by
+    MakeRoom() and _Tail never moves under the consumer between its
+    load and store.  QUEUE_DROP_LOWEST ranks
+    the elements with RANK(), a higher rank is kept longer.  Equal
+    ranks drop the element being enqueued.
 */
 
+template <typename T>
+inline uint8_t cqueue_rank_none(T const &) { return 0; }
+
+template <typename T, uint16_t N
+         ,uint8_t POLICY = QUEUE_DROP_NEWEST
+         ,uint8_t (*RANK)(T const &) = cqueue_rank_none<T> >
 class cqueue
 {
 public:
+    typedef typename select_type<(N <= 128), uint8_t, uint16_t>::type index_type;
+
+    static const uint16_t CAPACITY = N;
+
+    static_assert(N >= 2, "cqueue needs at least two elements");
+    static_assert((N & (N - 1)) == 0, "cqueue capacity must be a power of two");
+    static_assert(N <= 32768, "cqueue capacity must fit the 16 bit free running indices");
+    static_assert(POLICY <= QUEUE_DROP_LOWEST, "unknown cqueue overflow policy");
+
     cqueue()
-    : front(-1)
-    , rear(-1)
-    , count(0)
+    : _Head(0)
+    , _Tail(0)
     , HighWaterValue(0)
     { }
 
-    virtual ~cqueue() {}
-    bool Enqueue(event_element_class const &A);
-    bool Dequeue(event_element_class &A);
+    // Producer side (ISR or main loop).  Runs with interrupts masked,
+    //  a main loop producer can't be split by an ISR.  Returns
+    //  false when the queue was full, the element the POLICY shed
+    //  (A itself or a queued one) is copied to dropped.
+    bool Enqueue(T const &A, T &dropped)
+    {
+        bool kept = true;
+
+        // Only masks interrupts when called outside of an ISR
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+            index_type const head = _Head;
+            index_type const used = head - _Tail;
+
+            if (used == N)
+            {
+                if (!MakeRoom(A, dropped))
+                {
+                    return false;
+                }
+                kept = false;
+            }
+
+            data[head & MASK] = A;
+#if EVENT_STAMP
+            stamp[head & MASK] = timebase_class::NowFromIsr();
+#endif
+            STATIC_QUEUE_BARRIER();
+            _Head = head + 1;
+
+            if (kept && (used >= HighWaterValue)) HighWaterValue = used + 1;
+        }
+
+        return kept;
+    }
+
+    bool Enqueue(T const &A)
+    {
+        T dropped;
+        return Enqueue(A, dropped);
+    }
+
+    // Producer side.  Offers A to the newest queued element first, when
+    //  merge() folds A into it nothing is added.  The consumer of a
+    //  queue that merges has to use DequeueLocked(), the newest element
+    //  may be changed until it is dequeued.
+    typedef bool (*merge_type)(T &queued, T const &A);
+
+    bool Enqueue(T const &A, merge_type const merge, T &dropped)
+    {
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+            index_type const head = _Head;
+
+            if ((head != _Tail) && merge(data[(index_type)(head - 1) & MASK], A))
+            {
+                return true;
+            }
+        }
+
+        return Enqueue(A, dropped);
+    }
+
+    // Consumer side (main loop).  Lock-free only with QUEUE_DROP_NEWEST
+    //  and 8 bit indices (N <= 128): the producer never moves _Tail and
+    //  _Head is read in one load.  16 bit indices mask the _Head read,
+    //  the other policies run DequeueLocked().  Not for a queue that
+    //  merges, see Enqueue().
+    bool Dequeue(T &A)
+    {
+        if (POLICY != QUEUE_DROP_NEWEST)
+        {
+            return DequeueLocked(A);
+        }
+        return Take(A);
+    }
+
+    // Consumer side.  Copies up to max elements (and with EVENT_STAMP
+    //  their enqueue stamps).  Each element is copied and its slot
+    //  freed in a critical section of its own, as in DequeueLocked(),
+    //  an ISR waits for one element copy at most.  Safe with every
+    //  POLICY and with merging.  Returns the number copied.
+    uint8_t DequeueBatch(T *A, uint16_t *enqueued, uint8_t const max)
+    {
+        uint8_t count = 0;
+
+        while (count < max)
+        {
+            bool taken;
+            ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                taken = Take(A[count]);
+            }
+            if (!taken) break;
+#if EVENT_STAMP
+            enqueued[count] = LastEnqueued;
+#endif
+            count++;
+        }
+#if !EVENT_STAMP
+        (void)enqueued;
+#endif
+
+        return count;
+    }
+
+    // Consumer side of a queue that merges.  The element can't be
+    //  merged into while it is copied out.
+    bool DequeueLocked(T &A)
+    {
+        bool dequeued;
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+            dequeued = Take(A);
+        }
+        return dequeued;
+    }
 
-    inline uint8_t ElemNum(void) { return count; }
-    inline bool IsEmpty(void) { return ElemNum(); }
-    inline uint8_t HighWaterMark(void) { return HighWaterValue; }
+    inline index_type ElemNum(void) { return (index_type)(Head() - Tail()); }
+    inline bool IsEmpty(void) { return Head() == Tail(); }
+    inline index_type HighWaterMark(void) { return HighWaterValue; }
+
+#if EVENT_STAMP
+    // Timebase stamps of the last event dequeued
+    inline uint16_t LastEnqueueStamp(void) { return LastEnqueued; }
+    inline uint16_t LastDequeueStamp(void) { return LastDequeued; }
+#endif
 
 private:
-    volatile int8_t front,rear;
-    volatile uint8_t count;
-    static const uint8_t STATIC_QUEUE_DEFAULT_SIZE=32;
-    event_element_class data[STATIC_QUEUE_DEFAULT_SIZE];
-    uint8_t HighWaterValue;
+    static const index_type MASK = N - 1;
+
+    bool Take(T &A)
+    {
+        index_type const tail = _Tail;
+
+        if (Head() == tail)
+        {
+            return false;
+        }
+
+        STATIC_QUEUE_BARRIER();
+        A = data[tail & MASK];
+#if EVENT_STAMP
+        LastEnqueued = stamp[tail & MASK];
+        LastDequeued = timebase_class::Now();
+#endif
+        STATIC_QUEUE_BARRIER();
+        _Tail = tail + 1;
+
+        return true;
+    }
+
+    // Full queue, interrupts masked.  Frees the slot of the element the
+    //  POLICY sheds and copies it to dropped.  False when A is shed.
+    bool MakeRoom(T const &A, T &dropped)
+    {
+        index_type const tail = _Tail;
+        index_type victim = 0;
+
+        if (POLICY == QUEUE_DROP_NEWEST)
+        {
+            dropped = A;
+            return false;
+        }
+
+        if (POLICY == QUEUE_DROP_LOWEST)
+        {
+            // Oldest element ranked below A
+            uint8_t lowest = RANK(A);
+            victim = N;
+            for (index_type i = 0; i < N; i++)
+            {
+                uint8_t const rank = RANK(data[(index_type)(tail + i) & MASK]);
+                if (rank < lowest)
+                {
+                    lowest = rank;
+                    victim = i;
+                }
+            }
+            if (victim == N)
+            {
+                dropped = A;
+                return false;
+            }
+        }
+
+        dropped = data[(index_type)(tail + victim) & MASK];
+
+        // Close the gap, the elements older than the victim move up
+        for (index_type i = victim; i > 0; i--)
+        {
+            index_type const to = (index_type)(tail + i) & MASK;
+            index_type const from = (index_type)(tail + i - 1) & MASK;
+            data[to] = data[from];
+#if EVENT_STAMP
+            stamp[to] = stamp[from];
+#endif
+        }
+        _Tail = tail + 1;
+
+        return true;
+    }
+
+    // Producer index as seen by the consumer
+    inline index_type Head(void)
+    {
+        if (sizeof(index_type) == 1) return _Head;
+
+        index_type head;
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+            head = _Head;
+        }
+        return head;
+    }
+
+    // Consumer index as seen by the consumer, the producer moves it
+    //  too when the POLICY sheds queued elements
+    inline index_type Tail(void)
+    {
+        if ((sizeof(index_type) == 1) || (POLICY == QUEUE_DROP_NEWEST)) return _Tail;
+
+        index_type tail;
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+            tail = _Tail;
+        }
+        return tail;
+    }
+
+    volatile index_type _Head; // Written by the producer only
+    volatile index_type _Tail; // Consumer, and MakeRoom() with interrupts masked
+    T data[N];
+    index_type HighWaterValue;
+
+#if EVENT_STAMP
+    uint16_t stamp[N];
+    uint16_t LastEnqueued;
+    uint16_t LastDequeued;
+#endif
 };
 
+template <typename T, uint16_t N, uint8_t POLICY, uint8_t (*RANK)(T const &)>
+const uint16_t cqueue<T, N, POLICY, RANK>::CAPACITY;
+
 }
 
 #endif
-
@@ -0,0 +1,136 @@
+/****************************************************
+    Host Test
+
+    File:   tests/host_test.cpp
+    Author: agent
+    agent AT local
+
+    tests/host_test.cpp file is part of the RGB LED Controller and Node
+     version 1 hardware project.
+
+    This file contains the runner of the host regression tests (see
+     tests/host_test.h).
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+
+*****************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#ifndef _HOST_TEST_H_
+#include "host_test.h"
+#endif
+
+host_test *host_test::_First = 0;
+host_test *host_test::_Last = 0;
+
+host_test::host_test(char const *aName, Body const &aBody)
+: _Name(aName)
+, _Body(aBody)
+, _Next(0)
+{
+    if (_Last) _Last->_Next = this;
+    else _First = this;
+    _Last = this;
+}
+
+void host_test::Fail(char const *aFile
+                    ,int const &aLine
+                    ,char const *aExpr)
+{
+    printf("  %s:%d: CHECK(%s) failed\n", aFile, aLine, aExpr);
+    fflush(stdout);
+    _exit(1);
+}
+
+void host_test::FailEqual(char const *aFile
+                         ,int const &aLine
+                         ,char const *aExpr
+                         ,long long const &aExpected
+                         ,long long const &aActual)
+{
+    printf("  %s:%d: %s is %lld, expected %lld\n", aFile, aLine, aExpr, aActual, aExpected);
+    fflush(stdout);
+    _exit(1);
+}
+
+bool host_test::Selected(char const *aName
+                        ,char const * const *aNames
+                        ,int const &aCount)
+{
+    if (aCount == 0) return true;
+    for (int i = 0; i < aCount; i++) {
+        if (!strcmp(aName, aNames[i])) return true;
+    }
+    return false;
+}
+
+// The child starts from the state the static constructors left
+bool host_test::Run(host_test const &aTest)
+{
+    fflush(stdout);
+
+    pid_t const pid = fork();
+    if (pid < 0) {
+        perror("fork");
+        return false;
+    }
+    if (pid == 0) {
+        aTest._Body();
+        fflush(stdout);
+        _exit(0);
+    }
+
+    int status = 0;
+    if (waitpid(pid, &status, 0) != pid) return false;
+    if (WIFSIGNALED(status)) {
+        printf("  killed by signal %d\n", WTERMSIG(status));
+        return false;
+    }
+    return WIFEXITED(status) && (WEXITSTATUS(status) == 0);
+}
+
+int host_test::RunAll(char const * const *aNames, int const &aCount)
+{
+    int run = 0;
+    int failed = 0;
+
+    for (host_test *t = _First; t; t = t->_Next) {
+        if (!Selected(t->_Name, aNames, aCount)) continue;
+
+        run++;
+        bool const passed = Run(*t);
+        if (!passed) failed++;
+        printf("%s\t%s\n", passed ? "pass" : "FAIL", t->_Name);
+    }
+
+    printf("%d tests, %d failed\n", run, failed);
+    return failed;
+}
+
+int main(int argc, char *argv[])
+{
+    return host_test::RunAll(argv + 1, argc - 1) ? 1 : 0;
+}
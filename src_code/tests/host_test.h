@@ -0,0 +1,112 @@
+/****************************************************
+    Host Test
+
+    File:   tests/host_test.h
+    Author: agent
+    agent AT local
+
+    tests/host_test.h file is part of the RGB LED Controller and Node
+     version 1 hardware project.
+
+    This file contains the regression test runner of the host build.
+     A test is a function declared with HOST_TEST().  Every test runs
+     in a child process of its own, it starts from the firmware state
+     the static constructors leave (the register file of hal_host and
+     every singleton) and can't disturb the tests after it.
+
+    Usage:
+      host_tests [name ...]    (no name runs every test)
+
+    Exit status is 0 when every test passed.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+
+*****************************************************/
+
+#ifndef _HOST_TEST_H_
+#define _HOST_TEST_H_
+
+#include <stdint.h>
+
+class host_test
+{
+public:
+    typedef void (*Body)();
+
+    // Registers the test, HOST_TEST() builds one per test
+    host_test(char const *aName, Body const &aBody);
+
+    // Runs the tests named (all when aCount is 0), prints a line per
+    //  test and returns the number failed
+    static int RunAll(char const * const *aNames, int const &aCount);
+
+    // Failed check, ends the test
+    static void Fail(char const *aFile
+                    ,int const &aLine
+                    ,char const *aExpr);
+    static void FailEqual(char const *aFile
+                         ,int const &aLine
+                         ,char const *aExpr
+                         ,long long const &aExpected
+                         ,long long const &aActual);
+
+private:
+    static bool Selected(char const *aName
+                        ,char const * const *aNames
+                        ,int const &aCount);
+    static bool Run(host_test const &aTest);
+
+    char const *_Name;
+    Body _Body;
+    host_test *_Next;
+
+    static host_test *_First;
+    static host_test *_Last;
+};
+
+#define HOST_TEST(name) \
+    static void name(); \
+    static host_test name##_registered(#name, &name); \
+    static void name()
+
+#define CHECK(expr) \
+    do { \
+        if (!(expr)) host_test::Fail(__FILE__, __LINE__, #expr); \
+    } while (0)
+
+#define CHECK_EQUAL(expected, actual) \
+    do { \
+        long long const e_ = (long long)(expected); \
+        long long const a_ = (long long)(actual); \
+        if (e_ != a_) host_test::FailEqual(__FILE__, __LINE__, #actual, e_, a_); \
+    } while (0)
+
+// actual within [low, high]
+#define CHECK_RANGE(low, high, actual) \
+    do { \
+        long long const a_ = (long long)(actual); \
+        if ((a_ < (long long)(low)) || (a_ > (long long)(high))) \
+        { \
+            host_test::FailEqual(__FILE__, __LINE__, #actual " in [" #low ", " #high "]", (low), a_); \
+        } \
+    } while (0)
+
+#endif
@@ -0,0 +1,339 @@
+/****************************************************
+    Event Queue Tests
+
+    File:   tests/test_event_queue.cpp
+    Author: agent
+    agent AT local
+
+    tests/test_event_queue.cpp file is part of the RGB LED Controller
+     and Node version 1 hardware project.
+
+    This file contains the host tests of the overflow policies of the
+     cqueue ring, the EventQueue drop accounting and the batch
+     dequeue.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+    2026 Oct 17  agent              Batch dequeue.
+
+*****************************************************/
+
+#ifndef _HOST_TEST_H_
+#include "host_test.h"
+#endif
+
+#ifndef _EVENT_QUEUE_H_
+#include "event_queue.h"
+#endif
+
+using namespace STATIC_QUEUE_EVENT_LISTING;
+
+// MakeRoom() only ranks the slots of a full queue, g++ can't see that
+//  every slot RANK() reads was written
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+// Tens digit is the rank
+static uint8_t rank_tens(uint8_t const &A) { return A / 10; }
+
+typedef cqueue<uint8_t, 4, QUEUE_DROP_NEWEST, rank_tens> newest_queue;
+typedef cqueue<uint8_t, 4, QUEUE_DROP_OLDEST, rank_tens> oldest_queue;
+typedef cqueue<uint8_t, 4, QUEUE_DROP_LOWEST, rank_tens> lowest_queue;
+
+template <typename Q>
+static void check_contents(Q &q, uint8_t const *expected, uint8_t const count)
+{
+    uint8_t v = 0;
+    CHECK_EQUAL(count, q.ElemNum());
+    for (uint8_t i = 0; i < count; i++)
+    {
+        CHECK(q.Dequeue(v));
+        CHECK_EQUAL(expected[i], v);
+    }
+    CHECK(q.IsEmpty());
+}
+
+HOST_TEST(policy_drop_newest)
+{
+    newest_queue q;
+    uint8_t dropped = 0;
+
+    for (uint8_t i = 1; i <= 4; i++) CHECK(q.Enqueue(i));
+    CHECK(!q.Enqueue(35, dropped));
+    CHECK_EQUAL(35, dropped);
+
+    uint8_t const expected[] = { 1, 2, 3, 4 };
+    check_contents(q, expected, 4);
+}
+
+HOST_TEST(policy_drop_oldest)
+{
+    oldest_queue q;
+    uint8_t dropped = 0;
+
+    for (uint8_t i = 1; i <= 4; i++) CHECK(q.Enqueue(i));
+    CHECK(!q.Enqueue(5, dropped));
+    CHECK_EQUAL(1, dropped);
+    CHECK(!q.Enqueue(6, dropped));
+    CHECK_EQUAL(2, dropped);
+
+    uint8_t const expected[] = { 3, 4, 5, 6 };
+    check_contents(q, expected, 4);
+
+    // Room again, nothing is shed
+    CHECK(q.Enqueue(7));
+    uint8_t const again[] = { 7 };
+    check_contents(q, again, 1);
+}
+
+HOST_TEST(policy_drop_lowest)
+{
+    lowest_queue q;
+    uint8_t dropped = 0;
+
+    CHECK(q.Enqueue(15));
+    CHECK(q.Enqueue(5));
+    CHECK(q.Enqueue(25));
+    CHECK(q.Enqueue(3));
+
+    // Oldest of the lowest rank goes, the older elements move up
+    CHECK(!q.Enqueue(12, dropped));
+    CHECK_EQUAL(5, dropped);
+
+    // Nothing ranked below 0, the new element is shed
+    CHECK(!q.Enqueue(9, dropped));
+    CHECK_EQUAL(9, dropped);
+
+    CHECK(!q.Enqueue(13, dropped));
+    CHECK_EQUAL(3, dropped);
+
+    // Equal ranks keep the queued element
+    CHECK(!q.Enqueue(14, dropped));
+    CHECK_EQUAL(14, dropped);
+
+    uint8_t const expected[] = { 15, 25, 12, 13 };
+    check_contents(q, expected, 4);
+}
+
+// The ring wraps while the policy sheds from the producer side
+HOST_TEST(policy_drop_oldest_wrap)
+{
+    cqueue<uint16_t, 8, QUEUE_DROP_OLDEST> q;
+    uint16_t dropped = 0;
+    uint16_t v = 0;
+
+    for (uint16_t i = 0; i < 1000; i++)
+    {
+        bool const kept = q.Enqueue(i, dropped);
+        CHECK_EQUAL(i < 8, kept);
+        if (!kept) CHECK_EQUAL(i - 8, dropped);
+    }
+    for (uint16_t i = 992; i < 1000; i++)
+    {
+        CHECK(q.Dequeue(v));
+        CHECK_EQUAL(i, v);
+    }
+    CHECK(q.IsEmpty());
+}
+
+static event_element_class event(E_InputHardware const A, E_InputEvent const B, uint8_t const C = 0)
+{
+    return event_element_class(A, B, C);
+}
+
+// Default Makefile policies: interactive QUEUE_DROP_LOWEST, timer
+//  QUEUE_DROP_OLDEST, bulk QUEUE_DROP_NEWEST
+HOST_TEST(event_queue_drop_accounting)
+{
+    EventQueue q;
+    event_element_class e;
+
+    // Interactive: button edges outrank a rotation
+    for (uint8_t i = 0; i < EVENT_QUEUE_INTERACTIVE_SIZE; i++)
+    {
+        CHECK(q.Enqueue(event(E_BUTTON_01, (i & 1) ? E_BUTTON_IS_RELEASED : E_BUTTON_IS_PRESSED)));
+    }
+    CHECK(!q.Enqueue(event(E_ROTARY_ENCODER_01, E_ROTARY_ENCODER_ROTATED_CW, 1)));
+
+    // Timer: the oldest expiration goes
+    for (uint8_t i = 0; i <= EVENT_QUEUE_TIMER_SIZE; i++)
+    {
+        CHECK_EQUAL(i < EVENT_QUEUE_TIMER_SIZE, q.Enqueue(event(E_TIMER_01, E_TIMER_EXPIRE, i)));
+    }
+
+    // Bulk: the new msg goes
+    for (uint8_t i = 0; i <= EVENT_QUEUE_BULK_SIZE; i++)
+    {
+        CHECK_EQUAL(i < EVENT_QUEUE_BULK_SIZE, q.Enqueue(event(E_UART_00, E_SET_RED, i)));
+    }
+
+    CHECK_EQUAL(1, q.Drops(EventQueue::E_CLASS_INTERACTIVE));
+    CHECK_EQUAL(1, q.Drops(EventQueue::E_CLASS_TIMER));
+    CHECK_EQUAL(1, q.Drops(EventQueue::E_CLASS_BULK));
+    CHECK_EQUAL(1, q.Drops(E_ROTARY_ENCODER_01));
+    CHECK_EQUAL(0, q.Drops(E_BUTTON_01));
+    CHECK_EQUAL(1, q.Drops(E_TIMER_01));
+    CHECK_EQUAL(1, q.Drops(E_UART_00));
+
+    CHECK_EQUAL(EVENT_QUEUE_INTERACTIVE_SIZE, q.HighWaterMark(EventQueue::E_CLASS_INTERACTIVE));
+    CHECK_EQUAL(EVENT_QUEUE_BULK_SIZE, q.HighWaterMark(EventQueue::E_CLASS_BULK));
+
+    // Priority order, timer data 1.. after the oldest was shed
+    for (uint8_t i = 0; i < EVENT_QUEUE_INTERACTIVE_SIZE; i++)
+    {
+        CHECK(q.Dequeue(e));
+        CHECK_EQUAL(E_BUTTON_01, e.get_current_hardware());
+    }
+    for (uint8_t i = 1; i <= EVENT_QUEUE_TIMER_SIZE; i++)
+    {
+        CHECK(q.Dequeue(e));
+        CHECK_EQUAL(E_TIMER_01, e.get_current_hardware());
+        CHECK_EQUAL(i, e.get_current_data());
+    }
+    for (uint8_t i = 0; i < EVENT_QUEUE_BULK_SIZE; i++)
+    {
+        CHECK(q.Dequeue(e));
+        CHECK_EQUAL(E_UART_00, e.get_current_hardware());
+        CHECK_EQUAL(i, e.get_current_data());
+    }
+    CHECK(!q.Dequeue(e));
+
+    q.ClearStats();
+    CHECK_EQUAL(0, q.Drops(EventQueue::E_CLASS_TIMER));
+    CHECK_EQUAL(0, q.Drops(E_UART_00));
+}
+
+// Counters stop at 0xFFFF
+HOST_TEST(event_queue_drop_saturates)
+{
+    EventQueue q;
+
+    for (uint8_t i = 0; i < EVENT_QUEUE_BULK_SIZE; i++)
+    {
+        CHECK(q.Enqueue(event(E_UART_00, E_SET_RED, i)));
+    }
+    for (uint32_t i = 0; i < 0x10005UL; i++)
+    {
+        q.Enqueue(event(E_SPI_01, E_SPI_BYTE_COMPLETE));
+    }
+
+    CHECK_EQUAL(0xFFFF, q.Drops(EventQueue::E_CLASS_BULK));
+    CHECK_EQUAL(0xFFFF, q.Drops(E_SPI_01));
+    CHECK_EQUAL(0, q.Drops(E_UART_00));
+}
+
+// Drops counted from the main loop leave interrupts as they were
+HOST_TEST(event_queue_drop_restores_interrupts)
+{
+    EventQueue q;
+
+    for (uint8_t i = 0; i < EVENT_QUEUE_BULK_SIZE; i++)
+    {
+        CHECK(q.Enqueue(event(E_UART_00, E_SET_RED, i)));
+    }
+
+    sei();
+    CHECK(!q.Enqueue(event(E_UART_00, E_SET_RED)));
+    CHECK(SREG & (1 << SREG_I));
+
+    cli();
+    CHECK(!q.Enqueue(event(E_UART_00, E_SET_RED)));
+    CHECK(!(SREG & (1 << SREG_I)));
+
+    CHECK_EQUAL(2, q.Drops(E_UART_00));
+}
+
+HOST_TEST(cqueue_batch_dequeue)
+{
+    cqueue<uint8_t, 8> q;
+    uint8_t out[8];
+
+    // Start near the end of the ring so the batch wraps
+    for (uint8_t i = 0; i < 6; i++) CHECK(q.Enqueue(i));
+    CHECK_EQUAL(6, q.DequeueBatch(out, 0, 8));
+
+    for (uint8_t i = 10; i < 17; i++) CHECK(q.Enqueue(i));
+
+    CHECK_EQUAL(3, q.DequeueBatch(out, 0, 3));
+    CHECK_EQUAL(10, out[0]);
+    CHECK_EQUAL(11, out[1]);
+    CHECK_EQUAL(12, out[2]);
+    CHECK_EQUAL(4, q.ElemNum());
+
+    CHECK_EQUAL(4, q.DequeueBatch(out, 0, 8));
+    for (uint8_t i = 0; i < 4; i++) CHECK_EQUAL(13 + i, out[i]);
+
+    CHECK_EQUAL(0, q.DequeueBatch(out, 0, 8));
+    CHECK(q.IsEmpty());
+}
+
+// A batch takes the classes in priority order, up to EVENT_BATCH_SIZE
+HOST_TEST(event_queue_batch_priority)
+{
+    EventQueue q;
+    event_batch b;
+
+    CHECK(q.Enqueue(event(E_UART_00, E_SET_RED, 1)));
+    CHECK(q.Enqueue(event(E_UART_00, E_SET_RED, 2)));
+    CHECK(q.Enqueue(event(E_TIMER_01, E_TIMER_EXPIRE, 3)));
+    CHECK(q.Enqueue(event(E_BUTTON_02, E_BUTTON_IS_PRESSED, 4)));
+    CHECK(q.Enqueue(event(E_UART_00, E_SET_RED, 5)));
+    CHECK(q.Enqueue(event(E_BUTTON_02, E_BUTTON_IS_RELEASED, 6)));
+
+    uint8_t const expected[] = { 4, 6, 3, 1, 2, 5 };
+    uint8_t taken = 0;
+
+    while (q.Dequeue(b))
+    {
+        CHECK(b.count <= EVENT_BATCH_SIZE);
+        for (uint8_t i = 0; i < b.count; i++)
+        {
+            CHECK(taken < sizeof(expected));
+            CHECK_EQUAL(expected[taken], b.event[i].get_current_data());
+            taken++;
+        }
+    }
+
+    CHECK_EQUAL(sizeof(expected), taken);
+    CHECK_EQUAL(0, b.count);
+    CHECK(q.IsEmpty());
+}
+
+// An input that arrives between two batches is taken before the
+//  lower classes still queued
+HOST_TEST(event_queue_batch_late_input)
+{
+    EventQueue q;
+    event_batch b;
+
+    for (uint8_t i = 0; i < 2 * EVENT_BATCH_SIZE; i++)
+    {
+        CHECK(q.Enqueue(event(E_UART_00, E_SET_RED, i)));
+    }
+
+    CHECK(q.Dequeue(b));
+    CHECK_EQUAL(EVENT_BATCH_SIZE, b.count);
+
+    CHECK(q.Enqueue(event(E_BUTTON_01, E_BUTTON_IS_PRESSED, 0xAA)));
+
+    CHECK(q.Dequeue(b));
+    CHECK_EQUAL(EVENT_BATCH_SIZE, b.count);
+    CHECK_EQUAL(E_BUTTON_01, b.event[0].get_current_hardware());
+    CHECK_EQUAL(EVENT_BATCH_SIZE, b.event[1].get_current_data());
+}
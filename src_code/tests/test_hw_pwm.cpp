@@ -0,0 +1,167 @@
+/****************************************************
+    Hardware PWM Tests
+
+    File:   tests/test_hw_pwm.cpp
+    Author: agent
+    agent AT local
+
+    tests/test_hw_pwm.cpp file is part of the RGB LED Controller and Node
+     version 1 hardware project.
+
+    This file contains the host tests of the Timer0 compare unit PWM
+     (hw_pwm_class).  They run in the HW_PWM=1 builds of make test
+     (TEST_OPTIONS), with and without the diagnostic timebase on
+     Timer0.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+
+*****************************************************/
+
+#ifndef _HOST_TEST_H_
+#include "host_test.h"
+#endif
+
+#ifndef _HAL_HOST_H_
+#include "hal_host.h"
+#endif
+
+#ifndef _PWM_CLASS_H_
+#include "pwm_class.h"
+#endif
+
+#ifndef _TIMEBASE_CLASS_H_
+#include "timebase_class.h"
+#endif
+
+#if HW_PWM
+
+// Timer0 prescaler: the timebase's when it runs, else HW_PWM_CLOCK_SELECT
+#if TIMEBASE_IN_USE
+#define HW_PWM_PRESCALE TIMEBASE_PRESCALE
+#else
+#define HW_PWM_PRESCALE 64UL
+#endif
+#define HW_PWM_PERIOD_CYCLES (256UL * HW_PWM_PRESCALE)
+
+#define TIMER0_CLOCK_BITS ((1 << CS02) | (1 << CS01) | (1 << CS00))
+
+// Timer0 ticks the pin is lit in the next periods, one sample a tick
+static uint32_t lit_ticks(IOPinDefines::E_PinDef const aPin, uint8_t const periods)
+{
+    uint32_t lit = 0;
+    for (uint32_t tt = 0; tt < 256UL * periods; tt++)
+    {
+        hal_host::AdvanceTime(HW_PWM_PRESCALE);
+        if (hal_host::GetPin(aPin)) lit++;
+    }
+    return lit;
+}
+
+static void start_timebase()
+{
+#if TIMEBASE_IN_USE
+    timebase_class::Start();
+#endif
+}
+
+// The compare unit lights the pin for the duty of the level, no
+//  Timer2 interrupt, and hands it back to the port at 0x00 and 0xFF
+HOST_TEST(hw_pwm_duty)
+{
+    start_timebase();
+
+    pwm_class led(IOPinDefines::E_PIN_PD6, true, 0);
+    sei();
+
+    led.setValue(0x80);
+    // OCR0A takes the duty at the next period
+    hal_host::AdvanceTime(HW_PWM_PERIOD_CYCLES);
+
+    uint32_t const lit = lit_ticks(IOPinDefines::E_PIN_PD6, 4);
+    CHECK_EQUAL(4UL * (OCR0A + 1), lit);
+#if PWM_GAMMA
+    // Level 0x80 is a quarter of the period with gamma 2.2
+    CHECK_RANGE(4UL * 50, 4UL * 70, lit);
+#else
+    CHECK_EQUAL(4UL * 0x80, lit);
+#endif
+    CHECK_EQUAL(0, TIMSK2 & (1 << OCIE2A));
+
+    led.setValue(0xFF);
+    CHECK_EQUAL(256UL, lit_ticks(IOPinDefines::E_PIN_PD6, 1));
+
+    led.setValue(0x00);
+    CHECK_EQUAL(0UL, lit_ticks(IOPinDefines::E_PIN_PD6, 1));
+    CHECK_EQUAL(0, TCCR0A & ((1 << COM0A1) | (1 << COM0A0)));
+
+#if TIMEBASE_IN_USE
+    // The timebase keeps Timer0 running
+    CHECK_EQUAL(TIMEBASE_CLOCK_SELECT, TCCR0B & TIMER0_CLOCK_BITS);
+#else
+    // Last channel gone, Timer0 stopped
+    CHECK_EQUAL(0, TCCR0B & TIMER0_CLOCK_BITS);
+#endif
+}
+
+// One PWM period per Timer0 overflow, on the prescaler of the timebase
+//  when it runs.  The timebase ticks at F_CPU / TIMEBASE_PRESCALE.
+HOST_TEST(hw_pwm_period_and_ticks)
+{
+    start_timebase();
+
+    pwm_class led(IOPinDefines::E_PIN_PD5, true, 0);
+    sei();
+
+    led.setValue(0x40);
+#if TIMEBASE_IN_USE
+    CHECK_EQUAL(TIMEBASE_CLOCK_SELECT, TCCR0B & TIMER0_CLOCK_BITS);
+    uint32_t const overflows = hal_host::VectorCount(TIMER0_OVF_vect_num);
+    uint16_t const ticks = timebase_class::Now();
+#endif
+
+    // Rising edges of OC0B over 8 periods, sampled every tick
+    uint32_t const start = hal_host::Cycles();
+    uint32_t first = 0;
+    uint32_t last = 0;
+    uint8_t rises = 0;
+    bool level = hal_host::GetPin(IOPinDefines::E_PIN_PD5);
+    while (hal_host::Cycles() - start < 8 * HW_PWM_PERIOD_CYCLES)
+    {
+        hal_host::AdvanceTime(HW_PWM_PRESCALE);
+        bool const now = hal_host::GetPin(IOPinDefines::E_PIN_PD5);
+        if (now && !level)
+        {
+            if (rises == 0) first = hal_host::Cycles();
+            last = hal_host::Cycles();
+            rises++;
+        }
+        level = now;
+    }
+    CHECK(rises >= 7);
+    CHECK_EQUAL((rises - 1) * HW_PWM_PERIOD_CYCLES, last - first);
+
+#if TIMEBASE_IN_USE
+    CHECK_EQUAL(8UL, hal_host::VectorCount(TIMER0_OVF_vect_num) - overflows);
+    CHECK_EQUAL((uint16_t)(8 * 256), (uint16_t)(timebase_class::Now() - ticks));
+#endif
+}
+
+#endif
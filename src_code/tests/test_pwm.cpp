@@ -0,0 +1,339 @@
+/****************************************************
+    PWM Tests
+
+    File:   tests/test_pwm.cpp
+    Author: agent
+    agent AT local
+
+    tests/test_pwm.cpp file is part of the RGB LED Controller and Node
+     version 1 hardware project.
+
+    This file contains the host tests of the Timer2 software PWM
+     engines.  make test runs them once for every PWM_ENGINE.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+    2026 Oct 17  agent              Duty with the frame work charged.
+    2026 Oct 17  agent              Timer2 interrupts per frame, BAM
+                                      duty bits.
+    2026 Oct 17  agent              Dim range of the gamma table and
+                                      dithering.
+    2026 Oct 17  agent              Duty and frame length with the
+                                      Timer2 ISR kept waiting.
+
+*****************************************************/
+
+#ifndef _HOST_TEST_H_
+#include "host_test.h"
+#endif
+
+#ifndef _HAL_HOST_H_
+#include "hal_host.h"
+#endif
+
+#ifndef _PWM_CLASS_H_
+#include "pwm_class.h"
+#endif
+
+// CPU cycles of one duty step
+#if PWM_ENGINE == PWM_ENGINE_BAM
+#define PWM_STEP_CYCLES (PWM_FRAME_CYCLES / 255UL)
+#else
+#define PWM_STEP_CYCLES (PWM_FRAME_CYCLES / 256UL)
+#endif
+
+// Sampled every cycle, also the ones the Timer2 ISR is busy for
+static IOPinDefines::E_PinDef lit_pin;
+static uint64_t lit_end;
+static uint32_t lit_count;
+
+static void lit_sample()
+{
+    if ((hal_host::Cycles() <= lit_end) && hal_host::GetPin(lit_pin)) lit_count++;
+}
+
+// Cycles a frame the pin is lit, averaged over aFrames.  The busy
+//  cycles of an ISR run the clock on under AdvanceTime(), the window
+//  is counted on the clock.
+static uint32_t lit_cycles(IOPinDefines::E_PinDef const &aPin, uint8_t const &aFrames)
+{
+    lit_pin = aPin;
+    lit_end = hal_host::Cycles() + (uint64_t)aFrames * PWM_FRAME_CYCLES;
+    lit_count = 0;
+    hal_host::SetCycleHook(lit_sample);
+    while (hal_host::Cycles() < lit_end) hal_host::AdvanceTime(1);
+    hal_host::SetCycleHook(0);
+    return lit_count / aFrames;
+}
+
+// Cycles between the frames, from the rising edges of a pin lit at
+//  the same point of every frame
+static IOPinDefines::E_PinDef rise_pin;
+static bool rise_level;
+static uint64_t rise_last;
+static uint32_t rise_min;
+static uint32_t rise_max;
+
+static void rise_sample()
+{
+    bool const level = hal_host::GetPin(rise_pin);
+    if (level && !rise_level)
+    {
+        if (rise_last)
+        {
+            uint32_t const frame = hal_host::Cycles() - rise_last;
+            if (frame < rise_min) rise_min = frame;
+            if (frame > rise_max) rise_max = frame;
+        }
+        rise_last = hal_host::Cycles();
+    }
+    rise_level = level;
+}
+
+// Shortest and longest frame of aFrames
+static void frame_cycles(IOPinDefines::E_PinDef const &aPin
+                        ,uint8_t const &aFrames
+                        ,uint32_t &aMin
+                        ,uint32_t &aMax)
+{
+    rise_pin = aPin;
+    rise_level = hal_host::GetPin(aPin);
+    rise_last = 0;
+    rise_min = 0xFFFFFFFF;
+    rise_max = 0;
+    uint64_t const end = hal_host::Cycles() + (uint64_t)aFrames * PWM_FRAME_CYCLES;
+    hal_host::SetCycleHook(rise_sample);
+    while (hal_host::Cycles() < end) hal_host::AdvanceTime(1);
+    hal_host::SetCycleHook(0);
+    aMin = rise_min;
+    aMax = rise_max;
+}
+
+// Duty in steps.  The scheduled engines are given the step, the tick
+//  engine compares the value itself.
+static void set_steps(pwm_class &aLED, uint8_t const &aID, uint8_t const &aSteps)
+{
+    aLED.setValue(aSteps);
+#if PWM_ENGINE != PWM_ENGINE_TICK
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        TIMER2_interrupt_subject::pINTR_handler->SetDuty(aID, (pwm_duty_t)aSteps << PWM_DITHER_BITS);
+    }
+#else
+    (void)aID;
+#endif
+}
+
+// The fades and PWM tables of a frame take longer than a step.  An
+//  LED dimmed to the first steps keeps its duty, the compare of its
+//  edge is not missed (a missed one waits a Timer2 wrap).
+HOST_TEST(pwm_dim_duty_with_frame_work)
+{
+    static uint8_t const steps[] = { 1, 2, 3, 128 };
+
+    pwm_class dim(IOPinDefines::E_PIN_PC0, true, 0);
+    pwm_class mid(IOPinDefines::E_PIN_PC1, true, 0);
+    sei();
+
+    hal_host::SetBusy(HAL_HOST_BUSY_PWM_FRAME, 8 * PWM_STEP_CYCLES);
+
+    for (uint8_t ii = 0; ii < sizeof(steps); ii++)
+    {
+        set_steps(dim, 0, steps[ii]);
+        set_steps(mid, 1, 100);
+
+        // The duty shows from the frame after the next frame start
+        hal_host::AdvanceTime(2 * PWM_FRAME_CYCLES);
+
+        uint32_t const expected = steps[ii] * PWM_STEP_CYCLES;
+        CHECK_RANGE(expected - 16, expected + 16, lit_cycles(IOPinDefines::E_PIN_PC0, 4));
+    }
+}
+
+// Timer2 interrupts of a frame with LEDs at steps 1 and 100
+HOST_TEST(pwm_interrupts_per_frame)
+{
+#if PWM_ENGINE == PWM_ENGINE_TICK
+    uint32_t const expected = 256;
+#elif PWM_ENGINE == PWM_ENGINE_BAM
+    uint32_t const expected = 8;
+#else
+    // Frame start, the two edges and a pass through the gap to the
+    //  frame end (PWM_MAX_STEPS ahead at most)
+    uint32_t const expected = 4;
+#endif
+
+    pwm_class dim(IOPinDefines::E_PIN_PC0, true, 0);
+    pwm_class mid(IOPinDefines::E_PIN_PC1, true, 0);
+    sei();
+
+    set_steps(dim, 0, 1);
+    set_steps(mid, 1, 100);
+    hal_host::AdvanceTime(2 * PWM_FRAME_CYCLES);
+
+    uint32_t const start = hal_host::VectorCount(TIMER2_COMPA_vect_num);
+    hal_host::AdvanceTime(4 * PWM_FRAME_CYCLES);
+    CHECK_EQUAL(4 * expected, hal_host::VectorCount(TIMER2_COMPA_vect_num) - start);
+}
+
+#if PWM_ENGINE != PWM_ENGINE_TICK
+// Frames of a dither cycle, 4 at the least
+#define PWM_DITHER_FRAMES (((1U << PWM_DITHER_BITS) > 4) ? (1U << PWM_DITHER_BITS) : 4)
+
+// The lowest brightness levels through the gamma table and the
+//  dithering, with the frame work charged.  Level 1 is the smallest
+//  fraction of a step, no level is dimmer than the one below it.
+HOST_TEST(pwm_dim_range_gamma_dither)
+{
+    pwm_class led(IOPinDefines::E_PIN_PC0, true, 0);
+    sei();
+
+    hal_host::SetBusy(HAL_HOST_BUSY_PWM_FRAME, 8 * PWM_STEP_CYCLES);
+
+    uint32_t last = 0;
+    for (uint8_t level = 1; level <= 32; level++)
+    {
+        led.setValue(level);
+        hal_host::AdvanceTime(2 * PWM_FRAME_CYCLES);
+
+        uint32_t const lit = lit_cycles(IOPinDefines::E_PIN_PC0, PWM_DITHER_FRAMES);
+        if (level == 1)
+        {
+            uint32_t const expected = PWM_STEP_CYCLES >> PWM_DITHER_BITS;
+            CHECK_RANGE(expected - 16, expected + 16, lit);
+        }
+        CHECK(lit + 16 >= last);
+        last = lit;
+    }
+
+#if PWM_GAMMA
+    // Level 32 of 255 is about 1% of the frame with gamma 2.2
+    CHECK_RANGE(PWM_FRAME_CYCLES / 200, PWM_FRAME_CYCLES / 50, last);
+#endif
+}
+#endif
+
+#if PWM_ENGINE == PWM_ENGINE_BAM
+// A pin is lit in the periods of the bits set in its duty
+HOST_TEST(pwm_bam_duty_bits)
+{
+    static uint8_t const steps[] = { 0x01, 0x55, 0xAA, 0x81, 0x7F, 0xFE };
+
+    pwm_class led(IOPinDefines::E_PIN_PC0, true, 0);
+    sei();
+
+    for (uint8_t ii = 0; ii < sizeof(steps); ii++)
+    {
+        set_steps(led, 0, steps[ii]);
+        hal_host::AdvanceTime(2 * PWM_FRAME_CYCLES);
+
+        uint32_t const expected = steps[ii] * PWM_STEP_CYCLES;
+        CHECK_RANGE(expected - 16, expected + 16, lit_cycles(IOPinDefines::E_PIN_PC0, 4));
+    }
+}
+#endif
+
+// The Timer2 ISR runs 200 cycles late every time (other ISRs and
+//  critical sections ahead of it), less than the shortest PWM step.
+//  Every edge moves by the same amount, the duty and the frame
+//  length stay exact.
+HOST_TEST(pwm_duty_with_isr_latency)
+{
+    static uint8_t const steps[] = { 1, 0x55, 0x80 };
+
+    pwm_class led(IOPinDefines::E_PIN_PC0, true, 0);
+    pwm_class frame(IOPinDefines::E_PIN_PC1, true, 0);
+    sei();
+
+    hal_host::SetBusy(HAL_HOST_BUSY_PWM_LATENCY, 200);
+    hal_host::SetBusy(HAL_HOST_BUSY_PWM_FRAME, 8 * PWM_STEP_CYCLES);
+
+    // Slots are taken in the order the LEDs engage
+    set_steps(led, 0, steps[0]);
+    set_steps(frame, 1, 0x80);
+
+    for (uint8_t ii = 0; ii < sizeof(steps); ii++)
+    {
+        set_steps(led, 0, steps[ii]);
+        hal_host::AdvanceTime(2 * PWM_FRAME_CYCLES);
+
+        uint32_t const expected = steps[ii] * PWM_STEP_CYCLES;
+        CHECK_RANGE(expected - 16, expected + 16, lit_cycles(IOPinDefines::E_PIN_PC0, 4));
+    }
+
+    uint32_t shortest, longest;
+    frame_cycles(IOPinDefines::E_PIN_PC1, 8, shortest, longest);
+    CHECK_EQUAL(PWM_FRAME_CYCLES, shortest);
+    CHECK_EQUAL(PWM_FRAME_CYCLES, longest);
+}
+
+#if PWM_ENGINE == PWM_ENGINE_BAM
+// The Timer2 ISR runs later than the bit 0 and bit 1 periods.  The
+//  ISR catches up to the period due instead of waiting a Timer2 wrap
+//  for the compare it missed: the frame keeps its length, the long
+//  periods their duty.
+HOST_TEST(pwm_bam_late_isr_catches_up)
+{
+    pwm_class led(IOPinDefines::E_PIN_PC0, true, 0);
+    pwm_class frame(IOPinDefines::E_PIN_PC1, true, 0);
+    sei();
+
+    hal_host::SetBusy(HAL_HOST_BUSY_PWM_LATENCY, 3 * PWM_STEP_CYCLES + 100);
+    set_steps(led, 0, 0xF0);
+    set_steps(frame, 1, 0x80);
+    hal_host::AdvanceTime(2 * PWM_FRAME_CYCLES);
+
+    uint32_t const expected = 0xF0 * PWM_STEP_CYCLES;
+    CHECK_RANGE(expected - 16, expected + 16, lit_cycles(IOPinDefines::E_PIN_PC0, 4));
+
+    uint32_t shortest, longest;
+    frame_cycles(IOPinDefines::E_PIN_PC1, 8, shortest, longest);
+    CHECK_EQUAL(PWM_FRAME_CYCLES, shortest);
+    CHECK_EQUAL(PWM_FRAME_CYCLES, longest);
+
+    // Interrupts of a frame.  The ISR of bit 0 starts 3 ticks late,
+    //  past the end of bit 1, and stores the levels of bits 0..2.
+    //  The window is counted on the clock, the latency runs it on.
+    uint32_t const start = hal_host::VectorCount(TIMER2_COMPA_vect_num);
+    uint64_t const end = hal_host::Cycles() + 4 * PWM_FRAME_CYCLES;
+    while (hal_host::Cycles() < end) hal_host::AdvanceTime(1);
+    CHECK_EQUAL(4 * 6, hal_host::VectorCount(TIMER2_COMPA_vect_num) - start);
+}
+#endif
+
+#if (PWM_ENGINE == PWM_ENGINE_PORT) || (PWM_ENGINE == PWM_ENGINE_BAM)
+// A register that is not one of the ports leaves the slot without a
+//  pin, PORTB is not driven in its place
+HOST_TEST(pwm_set_pin_unknown_register)
+{
+    pwm_class led(IOPinDefines::E_PIN_PC0, true, 0);
+    led.setValue(128);
+    sei();
+
+    // The first slot attached
+    TIMER2_interrupt_subject::pINTR_handler->SetPin(0, &DDRB, 0, false);
+
+    uint8_t const portb = PORTB;
+    for (uint32_t t = 0; t < 3 * PWM_FRAME_CYCLES; t += 64)
+    {
+        hal_host::AdvanceTime(64);
+        CHECK_EQUAL(portb, PORTB);
+    }
+}
+#endif
@@ -0,0 +1,222 @@
+/****************************************************
+    PWM Fade Tests
+
+    File:   tests/test_pwm_fade.cpp
+    Author: agent
+    agent AT local
+
+    tests/test_pwm_fade.cpp file is part of the RGB LED Controller and
+     Node version 1 hardware project.
+
+    This file contains the host tests of the fade engine: the ramp
+     stepped in the Timer2 frame work, E_PWM_FADE_COMPLETE and the
+     completions lost to a full deferred work queue.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+    2026 Oct 17  agent              Dropped ramps to 0x00/0xFF leave
+                                      the engine.
+
+*****************************************************/
+
+#ifndef _HOST_TEST_H_
+#include "host_test.h"
+#endif
+
+#ifndef _HAL_HOST_H_
+#include "hal_host.h"
+#endif
+
+#ifndef _DEFERRED_WORK_H_
+#include "deferred_work.h"
+#endif
+
+#ifndef _PWM_FADE_CLASS_H_
+#include "pwm_fade_class.h"
+#endif
+
+#define MSECS(A) ((uint32_t)(A) * (F_CPU / 1000UL))
+
+// Frame work of a few PWM steps, the ramps step after the compare
+#define FADE_FRAME_WORK (PWM_FRAME_CYCLES / 32)
+
+// E_PWM_FADE_COMPLETE of each fade ID
+class complete_sink
+: public EventObserver
+{
+public:
+    complete_sink() { for (uint8_t ii = 0; ii < 8; ii++) _Count[ii] = 0; }
+
+    void Update(event_element_class const &A)
+    {
+        if ((A.get_current_event() == E_PWM_FADE_COMPLETE) && (A.get_current_data() < 8))
+        {
+            _Count[A.get_current_data()]++;
+        }
+    }
+
+    uint8_t Count(uint8_t const &aID)
+    {
+        deferred_work::Run();
+        return _Count[aID];
+    }
+
+private:
+    uint8_t _Count[8];
+};
+
+HOST_TEST(pwm_fade_ramp_completes)
+{
+    complete_sink q;
+    pwm_fade_class::pFade->Attach(&q);
+
+    pwm_class led(IOPinDefines::E_PIN_PC0, true, 0);
+    sei();
+    hal_host::SetBusy(HAL_HOST_BUSY_PWM_FRAME, FADE_FRAME_WORK);
+
+    CHECK(pwm_fade_class::pFade->start(&led, 200, 200, 7));
+
+    // Half way up the ramp, a frame either side
+    hal_host::AdvanceTime(MSECS(100));
+    CHECK_RANGE(70, 130, led.getValue());
+    CHECK_EQUAL(0, q.Count(7));
+
+    hal_host::AdvanceTime(MSECS(100) + 2 * PWM_FRAME_CYCLES);
+    CHECK_EQUAL(200, led.getValue());
+    CHECK_EQUAL(1, q.Count(7));
+    CHECK_EQUAL(0, pwm_fade_class::pFade->Dropped());
+}
+
+#if DEFERRED_WORK
+// Every completion of a frame finds the deferred work queue full.
+//  Each is counted once, the LEDs keep their targets, the slots are
+//  freed and take new ramps.
+HOST_TEST(pwm_fade_drop_frees_slot)
+{
+    static IOPinDefines::E_PinDef const pins[] = {
+         IOPinDefines::E_PIN_PC0, IOPinDefines::E_PIN_PC1
+        ,IOPinDefines::E_PIN_PC2, IOPinDefines::E_PIN_PC3
+        ,IOPinDefines::E_PIN_PC4, IOPinDefines::E_PIN_PC5
+        ,IOPinDefines::E_PIN_PB0, IOPinDefines::E_PIN_PB1
+    };
+    static_assert(PWM_FADE_SLOTS <= sizeof(pins) / sizeof(pins[0]), "A pin per fade slot");
+
+    complete_sink q;
+    pwm_fade_class::pFade->Attach(&q);
+
+    pwm_class *led[PWM_FADE_SLOTS];
+    for (uint8_t ii = 0; ii < PWM_FADE_SLOTS; ii++)
+    {
+        led[ii] = new pwm_class(pins[ii], true, 0);
+    }
+    sei();
+    hal_host::SetBusy(HAL_HOST_BUSY_PWM_FRAME, FADE_FRAME_WORK);
+
+    while (deferred_work::Post(deferred_work::E_WORK_PWM_FADE, PWM_FADE_SLOTS)) {}
+
+    for (uint8_t ii = 0; ii < PWM_FADE_SLOTS; ii++)
+    {
+        CHECK(pwm_fade_class::pFade->start(led[ii], 100 + ii, 1, ii));
+    }
+
+    // Not retried in the frames after
+    hal_host::AdvanceTime(4 * PWM_FRAME_CYCLES);
+    CHECK_EQUAL(PWM_FADE_SLOTS, pwm_fade_class::pFade->Dropped());
+    for (uint8_t ii = 0; ii < PWM_FADE_SLOTS; ii++)
+    {
+        CHECK_EQUAL(100 + ii, led[ii]->getValue());
+    }
+
+    // The stale work items name no slot
+    for (uint8_t ii = 0; ii < PWM_FADE_SLOTS; ii++)
+    {
+        CHECK_EQUAL(0, q.Count(ii));
+    }
+
+    // No slot holds Timer2 on once the LEDs leave the engine
+    for (uint8_t ii = 0; ii < PWM_FADE_SLOTS; ii++) led[ii]->setValue(0);
+    CHECK_EQUAL(0, TIMSK2 & (1 << OCIE2A));
+
+    for (uint8_t ii = 0; ii < PWM_FADE_SLOTS; ii++)
+    {
+        CHECK(pwm_fade_class::pFade->start(led[ii], 10, 1, ii));
+    }
+    hal_host::AdvanceTime(2 * PWM_FRAME_CYCLES);
+    for (uint8_t ii = 0; ii < PWM_FADE_SLOTS; ii++)
+    {
+        CHECK_EQUAL(1, q.Count(ii));
+    }
+    CHECK_EQUAL(PWM_FADE_SLOTS, pwm_fade_class::pFade->Dropped());
+}
+
+// Ramps to 0x00 and 0xFF end with the deferred work queue full.  The
+//  pins go back to the port, steady low and high, and Timer2 stops
+//  with no setValue() from the test.
+HOST_TEST(pwm_fade_drop_hands_pin_back)
+{
+    static IOPinDefines::E_PinDef const pins[] = {
+         IOPinDefines::E_PIN_PC0, IOPinDefines::E_PIN_PC1
+        ,IOPinDefines::E_PIN_PC2, IOPinDefines::E_PIN_PC3
+        ,IOPinDefines::E_PIN_PC4, IOPinDefines::E_PIN_PC5
+        ,IOPinDefines::E_PIN_PB0, IOPinDefines::E_PIN_PB1
+    };
+    static_assert(PWM_FADE_SLOTS <= sizeof(pins) / sizeof(pins[0]), "A pin per fade slot");
+
+    complete_sink q;
+    pwm_fade_class::pFade->Attach(&q);
+
+    // Even slots ramp up to 0xFF, odd slots down to 0x00
+    pwm_class *led[PWM_FADE_SLOTS];
+    for (uint8_t ii = 0; ii < PWM_FADE_SLOTS; ii++)
+    {
+        led[ii] = new pwm_class(pins[ii], true, 0);
+        if (ii & 1) led[ii]->setValue(0x80);
+    }
+    sei();
+    hal_host::SetBusy(HAL_HOST_BUSY_PWM_FRAME, FADE_FRAME_WORK);
+
+    while (deferred_work::Post(deferred_work::E_WORK_PWM_FADE, PWM_FADE_SLOTS)) {}
+
+    for (uint8_t ii = 0; ii < PWM_FADE_SLOTS; ii++)
+    {
+        CHECK(pwm_fade_class::pFade->start(led[ii], (ii & 1) ? 0x00 : 0xFF, 1, ii));
+    }
+
+    hal_host::AdvanceTime(4 * PWM_FRAME_CYCLES);
+    CHECK_EQUAL(PWM_FADE_SLOTS, pwm_fade_class::pFade->Dropped());
+    CHECK_EQUAL(0, TIMSK2 & (1 << OCIE2A));
+
+    // Steady levels over a frame
+    for (uint32_t tt = 0; tt < PWM_FRAME_CYCLES; tt += PWM_FRAME_CYCLES / 16)
+    {
+        for (uint8_t ii = 0; ii < PWM_FADE_SLOTS; ii++)
+        {
+            CHECK_EQUAL((ii & 1) ? 0x00 : 0xFF, led[ii]->getValue());
+            CHECK_EQUAL((ii & 1) == 0, hal_host::GetPin(pins[ii]));
+        }
+        hal_host::AdvanceTime(PWM_FRAME_CYCLES / 16);
+    }
+
+    for (uint8_t ii = 0; ii < PWM_FADE_SLOTS; ii++)
+    {
+        CHECK_EQUAL(0, q.Count(ii));
+    }
+}
+#endif
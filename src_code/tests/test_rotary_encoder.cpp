@@ -0,0 +1,299 @@
+/****************************************************
+    Rotary Encoder Tests
+
+    File:   tests/test_rotary_encoder.cpp
+    Author: agent
+    agent AT local
+
+    tests/test_rotary_encoder.cpp file is part of the RGB LED Controller
+     and Node version 1 hardware project.
+
+    This file contains the host tests of the rotary encoder step
+     merging: the merge in the EventQueue, the steps per E_RE_CW/CCW
+     msg on the wire and the steps carried over between address
+     changes in STATE_LED_SELECT.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+    2026 Oct 17  agent              Step counts in the E_RE_CW/CCW msgs.
+
+*****************************************************/
+
+#ifndef _HOST_TEST_H_
+#include "host_test.h"
+#endif
+
+#ifndef _HAL_HOST_H_
+#include "hal_host.h"
+#endif
+
+#ifndef _EVENT_QUEUE_H_
+#include "event_queue.h"
+#endif
+
+#ifndef _DEFERRED_WORK_H_
+#include "deferred_work.h"
+#endif
+
+#ifndef _RGB_CONTROLLER_STATE_MACHINE_H_
+#include "rgb_controller_state_machine.h"
+#endif
+
+static event_element_class rotation(E_InputEvent const A, uint8_t const steps)
+{
+    return event_element_class(E_ROTARY_ENCODER_01, A, steps);
+}
+
+HOST_TEST(encoder_merge_in_queue)
+{
+    EventQueue q;
+    event_element_class e;
+
+    for (uint8_t i = 0; i < 5; i++)
+    {
+        CHECK(q.Enqueue(rotation(E_ROTARY_ENCODER_ROTATED_CW, 1)));
+    }
+    CHECK(q.Enqueue(rotation(E_ROTARY_ENCODER_ROTATED_CCW, 1)));
+    CHECK(q.Enqueue(rotation(E_ROTARY_ENCODER_ROTATED_CCW, 2)));
+    CHECK(q.Enqueue(rotation(E_ROTARY_ENCODER_ROTATED_CW, 1)));
+
+    CHECK(q.Dequeue(e));
+    CHECK_EQUAL(E_ROTARY_ENCODER_ROTATED_CW, e.get_current_event());
+    CHECK_EQUAL(5, e.get_current_data());
+
+    CHECK(q.Dequeue(e));
+    CHECK_EQUAL(E_ROTARY_ENCODER_ROTATED_CCW, e.get_current_event());
+    CHECK_EQUAL(3, e.get_current_data());
+
+    // Only the newest element takes a merge
+    CHECK(q.Dequeue(e));
+    CHECK_EQUAL(E_ROTARY_ENCODER_ROTATED_CW, e.get_current_event());
+    CHECK_EQUAL(1, e.get_current_data());
+
+    CHECK(!q.Dequeue(e));
+}
+
+HOST_TEST(encoder_merge_limit)
+{
+    EventQueue q;
+    event_element_class e;
+
+    for (uint8_t i = 0; i < ROTARY_ENCODER_MAX_STEPS + 4; i++)
+    {
+        CHECK(q.Enqueue(rotation(E_ROTARY_ENCODER_ROTATED_CW, 1)));
+    }
+
+    CHECK(q.Dequeue(e));
+    CHECK_EQUAL(ROTARY_ENCODER_MAX_STEPS, e.get_current_data());
+    CHECK(q.Dequeue(e));
+    CHECK_EQUAL(4, e.get_current_data());
+    CHECK(!q.Dequeue(e));
+}
+
+// A button edge between rotations keeps them apart
+HOST_TEST(encoder_merge_keeps_order)
+{
+    EventQueue q;
+    event_element_class e;
+
+    CHECK(q.Enqueue(rotation(E_ROTARY_ENCODER_ROTATED_CW, 1)));
+    CHECK(q.Enqueue(event_element_class(E_ROTARY_ENCODER_01, E_BUTTON_IS_PRESSED)));
+    CHECK(q.Enqueue(rotation(E_ROTARY_ENCODER_ROTATED_CW, 1)));
+
+    CHECK(q.Dequeue(e));
+    CHECK_EQUAL(1, e.get_current_data());
+    CHECK(q.Dequeue(e));
+    CHECK_EQUAL(E_BUTTON_IS_PRESSED, e.get_current_event());
+    CHECK(q.Dequeue(e));
+    CHECK_EQUAL(1, e.get_current_data());
+}
+
+// Msgs the controller sends, deframed like comm_class does
+#define MAX_MSGS 64
+#define MSG_LENGTH 3
+
+static uint8_t msg[MAX_MSGS][MSG_LENGTH];
+static uint8_t msg_count = 0;
+static uint8_t msg_length = 0;
+static bool msg_escape = false;
+
+static void msg_sink(uint8_t const &aByte)
+{
+    if (aByte == UartBaseClass::COMM_CLASS_FLAG_BYTE)
+    {
+        if ((msg_length == MSG_LENGTH) && (msg_count < MAX_MSGS)) msg_count++;
+        msg_length = 0;
+        msg_escape = false;
+        return;
+    }
+
+    uint8_t data = aByte;
+    if (msg_escape)
+    {
+        data ^= UartBaseClass::COMM_CLASS_BYTE_STUFF_XOR_VALUE;
+        msg_escape = false;
+    }
+    else if (aByte == UartBaseClass::COMM_CLASS_ESCAPE_CHAR_START)
+    {
+        msg_escape = true;
+        return;
+    }
+
+    if ((msg_length < MSG_LENGTH) && (msg_count < MAX_MSGS))
+    {
+        msg[msg_count][msg_length] = data;
+    }
+    msg_length++;
+}
+
+static uint8_t count_msgs(E_InputEvent const A)
+{
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < msg_count; i++)
+    {
+        if ((msg[i][0] == E_RGB_CONTROLLER) && (msg[i][1] == A)) count++;
+    }
+    return count;
+}
+
+// Data of the last msg of the event, -1 without one
+static int last_msg_data(E_InputEvent const A)
+{
+    int data = -1;
+    for (uint8_t i = 0; i < msg_count; i++)
+    {
+        if ((msg[i][0] == E_RGB_CONTROLLER) && (msg[i][1] == A)) data = msg[i][2];
+    }
+    return data;
+}
+
+// Stands in for the main loop until the queues are empty
+static void drain(EventQueue &q, rgb_controller_state_machine &sm)
+{
+    event_element_class e;
+    for (;;)
+    {
+        deferred_work::Run();
+        if (!q.Dequeue(e)) break;
+        sm.process(e);
+    }
+    // Send whatever is still in the UART buffer
+    hal_host::Service();
+}
+
+static void process(EventQueue &q, rgb_controller_state_machine &sm, event_element_class A)
+{
+    sm.process(A);
+    drain(q, sm);
+}
+
+// All three buttons held until the timeout, then released
+static void enter_led_select(EventQueue &q, rgb_controller_state_machine &sm)
+{
+    process(q, sm, event_element_class(E_BUTTON_01, E_BUTTON_IS_PRESSED));
+    process(q, sm, event_element_class(E_BUTTON_02, E_BUTTON_IS_PRESSED));
+    process(q, sm, event_element_class(E_BUTTON_03, E_BUTTON_IS_PRESSED));
+
+    for (uint16_t ms = 0; (ms < 10000) && (count_msgs(E_SELECT) == 0); ms += 10)
+    {
+        hal_host::AdvanceTime(F_CPU / 100);
+        drain(q, sm);
+    }
+    CHECK_EQUAL(1, count_msgs(E_SELECT));
+
+    process(q, sm, event_element_class(E_BUTTON_01, E_BUTTON_IS_RELEASED));
+    process(q, sm, event_element_class(E_BUTTON_02, E_BUTTON_IS_RELEASED));
+    process(q, sm, event_element_class(E_BUTTON_03, E_BUTTON_IS_RELEASED));
+}
+
+// Up to ROTARY_ENCODER_MSG_STEPS steps per msg, the node address and
+//  the steps decode from the data byte
+HOST_TEST(encoder_steps_per_msg)
+{
+    EventQueue q;
+    rgb_controller_state_machine sm(&q);
+    hal_host::SetTxSink(msg_sink);
+    sei();
+    drain(q, sm);
+    msg_count = 0;
+
+    process(q, sm, rotation(E_ROTARY_ENCODER_ROTATED_CW, 5));
+    process(q, sm, rotation(E_ROTARY_ENCODER_ROTATED_CCW, ROTARY_ENCODER_MAX_STEPS));
+    process(q, sm, rotation(E_ROTARY_ENCODER_ROTATED_CW, 1));
+
+    uint8_t const cw_msgs = (5 + ROTARY_ENCODER_MSG_STEPS - 1) / ROTARY_ENCODER_MSG_STEPS + 1;
+    uint8_t const ccw_msgs = (ROTARY_ENCODER_MAX_STEPS + ROTARY_ENCODER_MSG_STEPS - 1) / ROTARY_ENCODER_MSG_STEPS;
+    CHECK_EQUAL(cw_msgs, count_msgs(E_RE_CW));
+    CHECK_EQUAL(ccw_msgs, count_msgs(E_RE_CCW));
+
+    uint8_t cw = 0;
+    uint8_t ccw = 0;
+    for (uint8_t i = 0; i < msg_count; i++)
+    {
+        CHECK_EQUAL(0, RE_MSG_ADDRESS(msg[i][2]));
+        CHECK(RE_MSG_STEPS(msg[i][2]) <= ROTARY_ENCODER_MSG_STEPS);
+        if (msg[i][1] == E_RE_CW) cw += RE_MSG_STEPS(msg[i][2]);
+        if (msg[i][1] == E_RE_CCW) ccw += RE_MSG_STEPS(msg[i][2]);
+    }
+    CHECK_EQUAL(6, cw);
+    CHECK_EQUAL(ROTARY_ENCODER_MAX_STEPS, ccw);
+
+    // A single step is the address alone, as before the step count
+    CHECK_EQUAL(0, last_msg_data(E_RE_CW));
+}
+
+// Merged steps past an address change count toward the next one, the
+//  changes land where single steps would have put them
+HOST_TEST(encoder_led_select_carries_steps)
+{
+    EventQueue q;
+    rgb_controller_state_machine sm(&q);
+    hal_host::SetTxSink(msg_sink);
+    sei();
+    drain(q, sm);
+    msg_count = 0;
+
+    enter_led_select(q, sm);
+    CHECK_EQUAL(0, last_msg_data(E_SELECT));
+
+    // 32 steps: one change at the 21st, 11 carried
+    process(q, sm, rotation(E_ROTARY_ENCODER_ROTATED_CW, 16));
+    process(q, sm, rotation(E_ROTARY_ENCODER_ROTATED_CW, 16));
+    CHECK_EQUAL(2, count_msgs(E_SELECT));
+    CHECK_EQUAL(1, last_msg_data(E_SELECT));
+
+    // 41 steps, one short of the second change
+    process(q, sm, rotation(E_ROTARY_ENCODER_ROTATED_CW, 9));
+    CHECK_EQUAL(2, count_msgs(E_SELECT));
+
+    process(q, sm, rotation(E_ROTARY_ENCODER_ROTATED_CW, 1));
+    CHECK_EQUAL(3, count_msgs(E_SELECT));
+    CHECK_EQUAL(2, last_msg_data(E_SELECT));
+
+    // Back down, the count left after the change is 0
+    process(q, sm, rotation(E_ROTARY_ENCODER_ROTATED_CCW, 16));
+    process(q, sm, rotation(E_ROTARY_ENCODER_ROTATED_CCW, 5));
+    CHECK_EQUAL(4, count_msgs(E_SELECT));
+    CHECK_EQUAL(1, last_msg_data(E_SELECT));
+
+    // Rotations in LED select don't reach the nodes
+    CHECK_EQUAL(0, count_msgs(E_RE_CW));
+    CHECK_EQUAL(0, count_msgs(E_RE_CCW));
+}
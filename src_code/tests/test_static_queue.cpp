@@ -0,0 +1,144 @@
+/****************************************************
+    Static Queue Tests
+
+    File:   tests/test_static_queue.cpp
+    Author: agent
+    agent AT local
+
+    tests/test_static_queue.cpp file is part of the RGB LED Controller
+     and Node version 1 hardware project.
+
+    This file contains the host tests of the cqueue ring: order, the
+     free running 8 and 16 bit indices and the high water mark.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+    2026 Oct 17  agent              cqueue size checked.
+
+*****************************************************/
+
+#ifndef _HOST_TEST_H_
+#include "host_test.h"
+#endif
+
+#ifndef _STATIC_QUEUE_H_
+#include "static_queue.h"
+#endif
+
+using namespace STATIC_QUEUE_EVENT_LISTING;
+
+#if !EVENT_STAMP
+// No vptr: the indices, the elements and the high water mark only
+static_assert(sizeof(cqueue<uint8_t, 8>) == 2 + 8 + 1, "cqueue carries more than its data");
+#endif
+
+HOST_TEST(cqueue_fifo_order)
+{
+    cqueue<uint8_t, 8> q;
+    uint8_t v = 0;
+
+    CHECK(q.IsEmpty());
+    CHECK(!q.Dequeue(v));
+
+    for (uint8_t i = 0; i < 5; i++) CHECK(q.Enqueue(i + 10));
+    CHECK_EQUAL(5, q.ElemNum());
+
+    for (uint8_t i = 0; i < 5; i++)
+    {
+        CHECK(q.Dequeue(v));
+        CHECK_EQUAL(i + 10, v);
+    }
+    CHECK(q.IsEmpty());
+}
+
+HOST_TEST(cqueue_full_keeps_queued)
+{
+    cqueue<uint8_t, 4> q;
+    uint8_t dropped = 0;
+    uint8_t v = 0;
+
+    for (uint8_t i = 0; i < 4; i++) CHECK(q.Enqueue(i));
+    CHECK(!q.Enqueue(99, dropped));
+    CHECK_EQUAL(99, dropped);
+    CHECK_EQUAL(4, q.ElemNum());
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        CHECK(q.Dequeue(v));
+        CHECK_EQUAL(i, v);
+    }
+    CHECK(!q.Dequeue(v));
+}
+
+// The 8 bit indices run over 255 many times
+HOST_TEST(cqueue_index_wrap_8bit)
+{
+    cqueue<uint16_t, 8> q;
+    uint16_t v = 0;
+    uint16_t in = 0;
+    uint16_t out = 0;
+
+    CHECK_EQUAL(1, sizeof(cqueue<uint16_t, 8>::index_type));
+
+    while (in < 2000)
+    {
+        CHECK(q.Enqueue(in++));
+        if (in & 1) CHECK(q.Enqueue(in++));
+        while (q.ElemNum() > 3)
+        {
+            CHECK(q.Dequeue(v));
+            CHECK_EQUAL(out++, v);
+        }
+    }
+    while (q.Dequeue(v)) CHECK_EQUAL(out++, v);
+    CHECK_EQUAL(in, out);
+}
+
+HOST_TEST(cqueue_index_wrap_16bit)
+{
+    cqueue<uint16_t, 256> q;
+    uint16_t v = 0;
+
+    CHECK_EQUAL(2, sizeof(cqueue<uint16_t, 256>::index_type));
+
+    for (uint32_t round = 0; round < 300; round++)
+    {
+        for (uint16_t i = 0; i < 256; i++) CHECK(q.Enqueue(i));
+        CHECK(!q.Enqueue(0));
+        for (uint16_t i = 0; i < 256; i++)
+        {
+            CHECK(q.Dequeue(v));
+            CHECK_EQUAL(i, v);
+        }
+        CHECK(q.IsEmpty());
+    }
+}
+
+HOST_TEST(cqueue_high_water_mark)
+{
+    cqueue<uint8_t, 8> q;
+    uint8_t v = 0;
+
+    for (uint8_t i = 0; i < 6; i++) CHECK(q.Enqueue(i));
+    while (q.Dequeue(v)) {}
+    CHECK(q.Enqueue(1));
+
+    CHECK_EQUAL(6, q.HighWaterMark());
+}
@@ -0,0 +1,118 @@
+/****************************************************
+    UART Tests
+
+    File:   tests/test_uart.cpp
+    Author: agent
+    agent AT local
+
+    tests/test_uart.cpp file is part of the RGB LED Controller and
+     Node version 1 hardware project.
+
+    This file contains the host tests of the USART RX path: frames
+     received back to back, with the work deferred or run inside
+     the ISR (DEFERRED_WORK=0), and the flag bytes of a batch.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+
+*****************************************************/
+
+#ifndef _HOST_TEST_H_
+#include "host_test.h"
+#endif
+
+#ifndef _HAL_HOST_H_
+#include "hal_host.h"
+#endif
+
+#ifndef _DEFERRED_WORK_H_
+#include "deferred_work.h"
+#endif
+
+#ifndef _COMM_HARNESS_H_
+#include "comm_harness.h"
+#endif
+
+// One short msg, flag to flag
+static uint8_t const report_request[] = { 0x7E, 0x08, 0x27, 0x06, 0x7E };
+
+// UART events by type
+class uart_sink
+: public EventObserver
+{
+public:
+    uart_sink() : _Rx(0), _Flags(0) {}
+
+    void Update(event_element_class const &A)
+    {
+        if (A.get_current_event() == E_UART_RX_EVENT) _Rx++;
+        if (A.get_current_event() == E_UART_FLAG_BYTE_FOUND_EVENT) _Flags++;
+    }
+
+    uint8_t _Rx;
+    uint8_t _Flags;
+};
+
+HOST_TEST(uart_frames_back_to_back)
+{
+    comm_harness h(nullptr, nullptr);
+
+    h.feed(report_request, sizeof(report_request));
+    h.feed(report_request, sizeof(report_request));
+    CHECK_EQUAL(2, h.frames());
+
+    // And after the main loop fell behind
+    for (uint8_t ii = 0; ii < sizeof(report_request); ii++)
+    {
+        hal_host::UartReceive(report_request[ii]);
+    }
+    for (uint8_t ii = 0; ii < sizeof(report_request); ii++)
+    {
+        hal_host::UartReceive(report_request[ii]);
+    }
+    deferred_work::Run();
+    CHECK_EQUAL(4, h.frames());
+}
+
+// Bytes received before the main loop runs share one work item,
+//  each flag byte among them is still reported
+HOST_TEST(uart_flag_bytes_in_batch)
+{
+    UartBaseClass uart(E_UART_00);
+    uart_sink q;
+    uart.Attach(&q);
+    sei();
+
+    for (uint8_t ii = 0; ii < sizeof(report_request); ii++)
+    {
+        hal_host::UartReceive(report_request[ii]);
+    }
+    deferred_work::Run();
+    CHECK_EQUAL(2, q._Flags);
+#if DEFERRED_WORK
+    CHECK_EQUAL(1, q._Rx);
+#else
+    CHECK_EQUAL(sizeof(report_request), q._Rx);
+#endif
+
+    hal_host::UartReceive(0x7E);
+    deferred_work::Run();
+    CHECK_EQUAL(3, q._Flags);
+}
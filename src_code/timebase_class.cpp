@@ -0,0 +1,77 @@
+/****************************************************
+    Timebase Class
+
+    File:   timebase_class.cpp
+    Author: agent
+    agent AT local
+
+    timebase_class.cpp file is part of the RGB LED Controller and Node 
+     version 1 hardware project.
+
+    This file contains the Timer0 setup and overflow ISR for the
+     free running timebase.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+    2026 Oct 17  agent              Shares Timer0 with the hardware
+                                      PWM channels.
+
+*****************************************************/
+
+#ifndef _TIMEBASE_CLASS_H_
+#include "timebase_class.h"
+#endif
+
+#ifndef _MCU_SLEEP_CLASS_H_
+#include "mcu_sleep_class.h"
+#endif
+
+#ifndef _POWER_STATS_H_
+#include "power_stats.h"
+#endif
+
+#if TIMEBASE_IN_USE
+
+volatile uint8_t timebase_class::_Overflows = 0;
+
+void timebase_class::Start()
+{
+    // Timer0 is kept powered down by the sleep class, turn it on.
+    mcu_sleep_class::getInstance()->SetInterfaceUsage(
+        mcu_sleep_class::E_TIMER_ZERO_INTERFACE,
+        mcu_sleep_class::E_POWER_INTERFACE_DISABLE_POWER_SAVINGS);
+
+    // Fast PWM mode counts from 0 to 0xFF like normal mode.  The
+    //  compare outputs stay with hw_pwm_class.
+    TCCR0A = (TCCR0A & ((1 << COM0A1) | (1 << COM0A0) | (1 << COM0B1) | (1 << COM0B0)))
+           | (1 << WGM01) | (1 << WGM00);
+    TCNT0 = 0;
+    TIFR0 = (1 << TOV0);     /* clear interrupt */
+    TIMSK0 = (1 << TOIE0);
+    TCCR0B = TIMEBASE_CLOCK_SELECT;
+}
+
+ISR(TIMER0_OVF_vect)
+{
+    timebase_class::_Overflows++;
+    POWER_STATS_TIMEBASE();
+}
+
+#endif
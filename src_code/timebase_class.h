@@ -0,0 +1,126 @@
+#ifndef _TIMEBASE_CLASS_H_
+#define _TIMEBASE_CLASS_H_
+
+/****************************************************
+    Timebase Class
+
+    File:   timebase_class.h
+    Author: agent
+    agent AT local
+
+    timebase_class.h file is part of the RGB LED Controller and Node 
+     version 1 hardware project.
+
+    This file contains a free running timebase built on Timer0.
+    Timer0 is otherwise unused (and powered down by mcu_sleep_class),
+     so the diagnostic builds borrow it to timestamp ISRs and events.
+    - Timer0 counts 0 to 0xFF (fast PWM mode, shared with the
+       hardware PWM channels of hw_pwm_class) with the
+       TIMEBASE_PRESCALE prescaler (set in the Makefile).  One tick
+       is TIMEBASE_PRESCALE cycles.
+    - The overflow ISR extends TCNT0 to a 16 bit tick count.
+    - The timebase is only started by the features that need it.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+    2026 Oct 17  agent              Shares Timer0 with the hardware
+                                      PWM channels.
+
+*****************************************************/
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+#ifndef ISR_PROFILE
+#define ISR_PROFILE 0
+#endif
+
+#ifndef EVENT_TRACE
+#define EVENT_TRACE 0
+#endif
+
+#ifndef EVENT_CAPTURE
+#define EVENT_CAPTURE 0
+#endif
+
+#ifndef POWER_STATS
+#define POWER_STATS 0
+#endif
+
+// The EventQueue stamps events with the timebase
+#define EVENT_STAMP (EVENT_TRACE || EVENT_CAPTURE)
+
+#ifndef TIMEBASE_PRESCALE
+#define TIMEBASE_PRESCALE 8
+#endif
+
+// Features making use of the timebase
+#define TIMEBASE_IN_USE (ISR_PROFILE || EVENT_STAMP || POWER_STATS)
+
+#if   (TIMEBASE_PRESCALE == 1)
+#define TIMEBASE_CLOCK_SELECT ((1 << CS00))
+#elif (TIMEBASE_PRESCALE == 8)
+#define TIMEBASE_CLOCK_SELECT ((1 << CS01))
+#elif (TIMEBASE_PRESCALE == 64)
+#define TIMEBASE_CLOCK_SELECT ((1 << CS01) | (1 << CS00))
+#elif (TIMEBASE_PRESCALE == 256)
+#define TIMEBASE_CLOCK_SELECT ((1 << CS02))
+#elif (TIMEBASE_PRESCALE == 1024)
+#define TIMEBASE_CLOCK_SELECT ((1 << CS02) | (1 << CS00))
+#else
+#error "TIMEBASE_PRESCALE must be 1, 8, 64, 256 or 1024"
+#endif
+
+class timebase_class
+{
+public:
+    // Power up Timer0 and start counting.
+    //  NOTE: call after mcu_sleep_class::EnableSleep()
+    static void Start();
+
+    // Current tick count.  Safe to call with interrupts enabled.
+    static uint16_t Now()
+    {
+        uint16_t result;
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+        {
+            result = NowFromIsr();
+        }
+        return result;
+    }
+
+    // Current tick count.  Interrupts must be disabled (ie from an ISR).
+    static inline uint16_t NowFromIsr() __attribute__((always_inline))
+    {
+        uint8_t high = _Overflows;
+        uint8_t low = TCNT0;
+
+        // Overflow happened but the overflow ISR hasn't run yet.
+        //  A small TCNT0 means it was read after the overflow.
+        if ((TIFR0 & (1 << TOV0)) && (low < 0x80)) high++;
+
+        return ((uint16_t)high << 8) | low;
+    }
+
+    static volatile uint8_t _Overflows;
+};
+
+#endif
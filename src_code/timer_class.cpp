@@ -45,6 +45,14 @@
 #include "mcu_sleep_class.h"
 #endif
 
+#ifndef _ISR_PROFILE_H_
+#include "isr_profile.h"
+#endif
+
+#ifndef _POWER_STATS_H_
+#include "power_stats.h"
+#endif
+
 #define TIMER1_RESOLUTION 65536UL  // Timer1 is 16 bit
 
 #define MILLISECOND_RESOLUTION 1000
@@ -209,7 +217,10 @@ void timer_class::Expired() {
 }
 
 ISR(TIMER1_OVF_vect) {
+	POWER_STATS_WAKE(E_ISR_TIMER1_OVF);
+	ISR_PROFILE_ENTER();
 	timer_class::pTimer->Expired();
+	ISR_PROFILE_EXIT(E_ISR_TIMER1_OVF);
 }
 
 
@@ -0,0 +1,250 @@
+/****************************************************
+    comm_class Deframer Benchmark
+
+    File:   tools/comm_bench.cpp
+    Author: agent
+    agent AT local
+
+    tools/comm_bench.cpp file is part of the RGB LED Controller and Node 
+     version 1 hardware project.
+
+    This file contains the host throughput benchmark of the comm_class
+     deframer.  Each stream is generated once into a buffer and fed
+     through the simulated USART0 (tools/comm_harness.h) until the
+     requested size is reached:
+      valid     well formed msgs, random content
+      escape    msgs made only of 0x7D/0x7E, every byte is stuffed
+      flags     runs of 1..64 flag bytes between valid msgs
+      oversize  40..100 byte msgs (buffer overflow path) between valid msgs
+      corrupt   valid msgs with flipped, dropped and inserted bytes
+      noise     random bytes
+
+    Output is a tab separated table on stdout:
+      stream  bytes  frames  expected  MB/s  frames/s
+     expected is "-" for the streams without a known msg count.  Exit
+     status is 1 when a stream decoded a different number of msgs.
+
+    Usage:
+      comm_bench [-m MB per stream] [-s seed]
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+
+*****************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef _COMM_HARNESS_H_
+#include "comm_harness.h"
+#endif
+
+// Each stream is generated into a buffer this size and repeated
+#define STREAM_BUFFER_SIZE (1UL << 20)
+
+static const uint8_t FLAG = UartBaseClass::COMM_CLASS_FLAG_BYTE;
+static const uint8_t ESCAPE = UartBaseClass::COMM_CLASS_ESCAPE_CHAR_START;
+static const uint8_t XOR_VALUE = UartBaseClass::COMM_CLASS_BYTE_STUFF_XOR_VALUE;
+
+struct stream_buffer
+{
+    uint8_t data[STREAM_BUFFER_SIZE];
+    uint32_t length;
+    uint32_t msgs;  // Valid msgs in the buffer
+
+    bool room(uint32_t const &A) const { return (length + A) <= STREAM_BUFFER_SIZE; }
+    void put(uint8_t const &A) { data[length++] = A; }
+    void stuff(uint8_t const &A)
+    {
+        if ((A == FLAG) || (A == ESCAPE)) {
+            put(ESCAPE);
+            put(A ^ XOR_VALUE);
+        } else {
+            put(A);
+        }
+    }
+};
+
+static stream_buffer stream;
+static uint32_t rng_state = 1;
+
+static uint32_t rng()
+{
+    // xorshift32
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+// Longest msg: 2 flags + 3 stuffed bytes
+#define MSG_MAX_BYTES 8
+
+static void put_msg(uint8_t const &A, uint8_t const &B, uint8_t const &C)
+{
+    stream.put(FLAG);
+    stream.stuff(A);
+    stream.stuff(B);
+    stream.stuff(C);
+    stream.put(FLAG);
+    stream.msgs++;
+}
+
+static void put_random_msg()
+{
+    put_msg(rng(), rng(), rng());
+}
+
+static void gen_valid()
+{
+    while (stream.room(MSG_MAX_BYTES)) put_random_msg();
+}
+
+static void gen_escape()
+{
+    while (stream.room(MSG_MAX_BYTES)) {
+        uint32_t const r = rng();
+        put_msg((r & 1) ? FLAG : ESCAPE
+               ,(r & 2) ? FLAG : ESCAPE
+               ,(r & 4) ? FLAG : ESCAPE);
+    }
+}
+
+static void gen_flags()
+{
+    while (stream.room(64 + MSG_MAX_BYTES)) {
+        uint32_t const run = 1 + (rng() % 64);
+        for (uint32_t i = 0; i < run; i++) stream.put(FLAG);
+        put_random_msg();
+    }
+}
+
+static void gen_oversize()
+{
+    while (stream.room(2 + 2 * 100 + MSG_MAX_BYTES)) {
+        uint32_t const length = 40 + (rng() % 61);
+        stream.put(FLAG);
+        for (uint32_t i = 0; i < length; i++) stream.stuff(rng());
+        stream.put(FLAG);
+        put_random_msg();
+    }
+}
+
+static void gen_corrupt()
+{
+    gen_valid();
+    stream.msgs = 0;
+
+    // Damage about one byte in 16 in place: flip, drop (into a
+    //  flag byte) or insert (an escape char).
+    for (uint32_t i = 0; i < stream.length; i++) {
+        uint32_t const r = rng();
+        if ((r & 0x0F) != 0) continue;
+        switch ((r >> 4) & 0x03)
+        {
+        case 0: stream.data[i] ^= (1 << ((r >> 8) & 0x07)); break;
+        case 1: stream.data[i] = FLAG; break;
+        case 2: stream.data[i] = ESCAPE; break;
+        default: stream.data[i] = r >> 8; break;
+        }
+    }
+}
+
+static void gen_noise()
+{
+    while (stream.room(1)) stream.put(rng());
+    stream.msgs = 0;
+}
+
+struct stream_type
+{
+    char const *name;
+    void (*generate)();
+    bool exact;  // msgs decoded must equal stream.msgs
+};
+
+static const stream_type streams[] = {
+     { "valid",    gen_valid,    true }
+    ,{ "escape",   gen_escape,   true }
+    ,{ "flags",    gen_flags,    true }
+    ,{ "oversize", gen_oversize, true }
+    ,{ "corrupt",  gen_corrupt,  false }
+    ,{ "noise",    gen_noise,    false }
+};
+
+static uint64_t nanoseconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t megabytes = 64;
+    uint32_t seed = 1;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-m") && (i + 1 < argc)) megabytes = strtoul(argv[++i], 0, 0);
+        else if (!strcmp(argv[i], "-s") && (i + 1 < argc)) seed = strtoul(argv[++i], 0, 0);
+        else {
+            fprintf(stderr, "usage: comm_bench [-m MB per stream] [-s seed]\n");
+            return 2;
+        }
+    }
+
+    comm_harness harness(0, 0);
+    int rc = 0;
+
+    printf("stream\tbytes\tframes\texpected\tMB/s\tframes/s\n");
+    for (uint8_t s = 0; s < sizeof(streams) / sizeof(streams[0]); s++) {
+        rng_state = seed ? seed : 1;
+        stream.length = 0;
+        stream.msgs = 0;
+        streams[s].generate();
+
+        // The buffer ends on a flag byte, the decoder is back to
+        //  searching for one at the start of the next repetition.
+        uint32_t const repeat = ((uint64_t)megabytes << 20) / stream.length + 1;
+        uint64_t const start_frames = harness.frames();
+
+        uint64_t const t0 = nanoseconds();
+        for (uint32_t r = 0; r < repeat; r++) {
+            harness.feed(stream.data, stream.length);
+        }
+        uint64_t const ns = nanoseconds() - t0;
+
+        uint64_t const bytes = (uint64_t)stream.length * repeat;
+        uint64_t const frames = harness.frames() - start_frames;
+        uint64_t const expected = (uint64_t)stream.msgs * repeat;
+
+        printf("%s\t%llu\t%llu\t", streams[s].name
+              ,(unsigned long long)bytes, (unsigned long long)frames);
+        if (streams[s].exact) printf("%llu", (unsigned long long)expected);
+        else printf("-");
+        printf("\t%.1f\t%.0f\n", bytes * 1e3 / ns / 1.048576, frames * 1e9 / ns);
+
+        if (streams[s].exact && (frames != expected)) rc = 1;
+    }
+
+    return rc;
+}
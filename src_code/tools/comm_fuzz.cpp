@@ -0,0 +1,237 @@
+/****************************************************
+    comm_class Deframer Fuzzer
+
+    File:   tools/comm_fuzz.cpp
+    Author: agent
+    agent AT local
+
+    tools/comm_fuzz.cpp file is part of the RGB LED Controller and Node 
+     version 1 hardware project.
+
+    This file contains the fuzz target of the comm_class deframer.
+     Every input is received on the simulated USART0 (see
+     tools/comm_harness.h) and the msgs decoded are checked against a
+     reference model of the msg format.  Out of bounds writes of the
+     msg buffer in comm_class::decode are caught by AddressSanitizer
+     (the firmware objects are built with -fsanitize=address).
+
+    Built two ways (see "make fuzz" in the Makefile):
+     - libFuzzer (clang++ -fsanitize=fuzzer), coverage guided
+     - COMM_FUZZ_STANDALONE, any compiler.  Runs the files named on
+        the command line, then random inputs:
+          comm_fuzz [-n iterations] [-s seed] [file ...]
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+
+*****************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef _COMM_HARNESS_H_
+#include "comm_harness.h"
+#endif
+
+// Reference model of the msg format (comm_class.h):
+//  - A msg starts at a flag byte, extra flag bytes are skipped
+//  - 0x7D escapes the next byte (XOR 0x20).  An escaped flag byte
+//     aborts the msg and starts the next one.
+//  - The msg ends at the next flag byte.  3 bytes is a valid msg.
+//  - The next msg needs its own start flag byte.
+//  - A msg longer than the decode buffer is dropped at the byte that
+//     does not fit, the search for a start flag byte resumes there.
+class comm_reference
+{
+public:
+    static const uint8_t BUFFER_SIZE = 32;
+
+    comm_reference()
+    : _State(E_SEARCH)
+    , _Length(0)
+    , _Count(0)
+    {}
+
+    void put(uint8_t const &A)
+    {
+        bool const flag = (A == UartBaseClass::COMM_CLASS_FLAG_BYTE);
+        bool const escape = (A == UartBaseClass::COMM_CLASS_ESCAPE_CHAR_START);
+
+        switch (_State)
+        {
+        case E_SEARCH:
+            _Length = 0;
+            if (flag) _State = E_FLAG;
+        break;
+        case E_FLAG:
+            if (flag) break;
+            if (escape) { _State = E_THIN; break; }
+            _Buffer[_Length++] = A;
+            _State = E_COLLECT;
+        break;
+        case E_COLLECT:
+            if (flag) {
+                if (_Length == 3) store();
+                _State = E_SEARCH;
+            } else if (escape) {
+                _State = E_THIN;
+            } else if (_Length >= BUFFER_SIZE - 1) {
+                _State = E_SEARCH;
+            } else {
+                _Buffer[_Length++] = A;
+            }
+        break;
+        case E_THIN:
+            if (flag) {
+                _Length = 0;
+                _State = E_FLAG;
+            } else if (_Length >= BUFFER_SIZE - 1) {
+                _State = E_SEARCH;
+            } else {
+                _Buffer[_Length++] = A ^ UartBaseClass::COMM_CLASS_BYTE_STUFF_XOR_VALUE;
+                _State = E_COLLECT;
+            }
+        break;
+        }
+    }
+
+    uint32_t count() const { return _Count; }
+    uint8_t const *msg(uint32_t const &A) const { return _Msgs[A]; }
+
+    static const uint32_t MAX_MSGS = 4096;
+
+private:
+    void store()
+    {
+        if (_Count < MAX_MSGS) memcpy(_Msgs[_Count], _Buffer, 3);
+        _Count++;
+    }
+
+    enum { E_SEARCH, E_FLAG, E_COLLECT, E_THIN } _State;
+    uint8_t _Buffer[BUFFER_SIZE];
+    uint8_t _Length;
+    uint32_t _Count;
+    uint8_t _Msgs[MAX_MSGS][3];
+};
+
+struct fuzz_result
+{
+    uint32_t count;
+    uint8_t msgs[comm_reference::MAX_MSGS][3];
+};
+
+static fuzz_result result;
+
+static void fuzz_sink(event_element_class const &A, void *)
+{
+    if (result.count < comm_reference::MAX_MSGS) {
+        result.msgs[result.count][0] = A.get_current_hardware();
+        result.msgs[result.count][1] = A.get_current_event();
+        result.msgs[result.count][2] = A.get_current_data();
+    }
+    result.count++;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(uint8_t const *aData, size_t aSize)
+{
+    static comm_reference *reference = new comm_reference;
+
+    // A fresh decoder per input
+    result.count = 0;
+    *reference = comm_reference();
+    {
+        comm_harness harness(fuzz_sink, 0);
+        harness.feed(aData, aSize);
+    }
+    for (size_t i = 0; i < aSize; i++) reference->put(aData[i]);
+
+    if (result.count != reference->count()) {
+        fprintf(stderr, "comm_fuzz: decoded %u msgs, expected %u\n"
+               ,result.count, reference->count());
+        abort();
+    }
+    for (uint32_t i = 0; (i < result.count) && (i < comm_reference::MAX_MSGS); i++) {
+        if (memcmp(result.msgs[i], reference->msg(i), 3)) {
+            fprintf(stderr, "comm_fuzz: msg %u differs\n", i);
+            abort();
+        }
+    }
+    return 0;
+}
+
+#ifdef COMM_FUZZ_STANDALONE
+
+static uint32_t rng_state = 1;
+
+static uint32_t rng()
+{
+    // xorshift32
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t iterations = 100000;
+    static uint8_t input[4096];
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-n") && (i + 1 < argc)) {
+            iterations = strtoul(argv[++i], 0, 0);
+        } else if (!strcmp(argv[i], "-s") && (i + 1 < argc)) {
+            rng_state = strtoul(argv[++i], 0, 0);
+            if (!rng_state) rng_state = 1;
+        } else {
+            FILE *f = fopen(argv[i], "rb");
+            if (!f) {
+                perror(argv[i]);
+                return 2;
+            }
+            size_t const length = fread(input, 1, sizeof(input), f);
+            fclose(f);
+            LLVMFuzzerTestOneInput(input, length);
+        }
+    }
+
+    // Random inputs biased towards the bytes the decoder cares about
+    static const uint8_t special[] = {
+         UartBaseClass::COMM_CLASS_FLAG_BYTE
+        ,UartBaseClass::COMM_CLASS_ESCAPE_CHAR_START
+        ,UartBaseClass::COMM_CLASS_FLAG_BYTE ^ UartBaseClass::COMM_CLASS_BYTE_STUFF_XOR_VALUE
+        ,UartBaseClass::COMM_CLASS_ESCAPE_CHAR_START ^ UartBaseClass::COMM_CLASS_BYTE_STUFF_XOR_VALUE
+    };
+    for (uint32_t n = 0; n < iterations; n++) {
+        uint32_t const length = rng() % sizeof(input);
+        uint32_t const bias = rng() & 0x07;
+        for (uint32_t i = 0; i < length; i++) {
+            uint32_t const r = rng();
+            input[i] = ((r & 0x07) < bias) ? special[(r >> 3) & 0x03] : (uint8_t)(r >> 8);
+        }
+        LLVMFuzzerTestOneInput(input, length);
+    }
+
+    printf("comm_fuzz: %u random inputs ok\n", iterations);
+    return 0;
+}
+
+#endif
@@ -0,0 +1,100 @@
+#ifndef _COMM_HARNESS_H_
+#define _COMM_HARNESS_H_
+
+/****************************************************
+    comm_class Harness
+
+    File:   tools/comm_harness.h
+    Author: agent
+    agent AT local
+
+    tools/comm_harness.h file is part of the RGB LED Controller and Node 
+     version 1 hardware project.
+
+    This file contains the host harness shared by the comm_class
+     deframer benchmark (comm_bench.cpp) and fuzzer (comm_fuzz.cpp).
+     Bytes are received on the simulated USART0 (host/hal_host.h) so
+     they take the same path as on the part:
+      USART_RX_vect -> UartBaseClass::receive -> Notify
+       -> comm_class::Update -> comm_class::decode
+     Every msg decoded is passed to a callback.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+
+*****************************************************/
+
+#ifndef _HAL_HOST_H_
+#include "hal_host.h"
+#endif
+
+#ifndef _COMM_CLASS_H_
+#include "comm_class.h"
+#endif
+
+#ifndef _DEFERRED_WORK_H_
+#include "deferred_work.h"
+#endif
+
+class comm_harness
+: public EventObserver
+{
+public:
+    // Called with every msg decoded
+    typedef void (*MsgSink)(event_element_class const &A, void *aContext);
+
+    comm_harness(MsgSink const &aSink, void *aContext)
+    : _Sink(aSink)
+    , _Context(aContext)
+    , _Frames(0)
+    {
+        _Comm.Attach(this);
+        sei();
+    }
+
+    virtual ~comm_harness() {
+        _Comm.Detach();
+    }
+
+    void feed(uint8_t const *aData, uint32_t const &aLength)
+    {
+        for (uint32_t i = 0; i < aLength; i++) {
+            hal_host::UartReceive(aData[i]);
+            // Stands in for the main loop
+            deferred_work::Run();
+        }
+    }
+
+    uint64_t frames() const { return _Frames; }
+
+    virtual void Update(event_element_class const &A)
+    {
+        _Frames++;
+        if (_Sink) _Sink(A, _Context);
+    }
+
+private:
+    comm_class _Comm;
+    MsgSink _Sink;
+    void *_Context;
+    uint64_t _Frames;
+};
+
+#endif
@@ -0,0 +1,250 @@
+#!/bin/sh
+#****************************************************
+#
+#    compare_builds.sh file is part of the CPP AVR build
+#     system.  It is called by "make compare" to show what a
+#     change costs in code size, RAM and CPU time.
+#
+#    - Builds the host firmware (make host) of two git revisions
+#       in temporary git worktrees, "." is the working tree.  Each
+#       side takes its own make variables, so two configurations
+#       of one tree compare the same way.
+#    - Diffs the per symbol code (text) and RAM (data/bss) sizes
+#       from the "nm -S" output and the "size" totals.
+#    - Runs both through "make benchrun" (tools/isr_bench.cpp) with
+#       the same scenario and compares the host ns per process()
+#       call and per ISR.
+#    - Prints every table ranked by the largest change.
+#
+#    The sizes are the host (x86-64) build's, the deltas show what
+#     grew or shrank, not the AVR byte counts.  A revision without
+#     "make benchrun" is compared on size only.
+#
+#    Usage:
+#      compare_builds.sh [-S scenario] [-b base make vars]
+#                        [-n new make vars] [-o outdir] base_rev [new_rev]
+#      compare_builds.sh -r outdir        (report an earlier run again)
+#
+#    Environment: MAKE, NM, SIZE
+#
+#    agent  - 2026 Oct 17
+#    agent AT local
+#
+#*****************************************************/
+
+AWK=awk
+MAKE=${MAKE:-make}
+NM=${NM:-nm}
+SIZE=${SIZE:-size}
+
+SCENARIO=tools/bench_scenario.txt
+BASE_DEFS=
+NEW_DEFS=
+OUTDIR=
+REPORT_ONLY=0
+
+usage() {
+    echo "Usage: compare_builds.sh [-S scenario] [-b base make vars] [-n new make vars] [-o outdir] base_rev [new_rev]" >&2
+    echo "       compare_builds.sh -r outdir" >&2
+    exit 1
+}
+
+while getopts "S:b:n:o:r:" opt; do
+    case $opt in
+    S) SCENARIO=$OPTARG ;;
+    b) BASE_DEFS=$OPTARG ;;
+    n) NEW_DEFS=$OPTARG ;;
+    o) OUTDIR=$OPTARG ;;
+    r) OUTDIR=$OPTARG; REPORT_ONLY=1 ;;
+    *) usage ;;
+    esac
+done
+shift `expr $OPTIND - 1`
+
+#----------------------------------------------------------------------------
+# Build one revision into $OUTDIR/<name>
+#  $1 = name (base/new), $2 = git revision ("." = working tree),
+#  $3 = make variables
+build_rev() {
+    name=$1
+    rev=$2
+    defs=$3
+    dest=$OUTDIR/$name
+    mkdir -p $dest
+
+    if test "$rev" = "."; then
+        src=.
+        echo "== $name: working tree $defs" >&2
+    else
+        prefix=`git rev-parse --show-prefix` || exit 1
+        tree=$OUTDIR/$name.tree
+        git worktree add --detach --force $tree $rev >/dev/null 2>&1 || {
+            echo "compare_builds.sh: unable to check out $rev" >&2
+            exit 1
+        }
+        WORKTREES="$WORKTREES $tree"
+        src=$tree/$prefix
+        echo "== $name: $rev (`git rev-parse --short $rev`) $defs" >&2
+    fi
+
+    # Own object directory, the working tree's obj_host is left alone
+    obj=obj_compare_$name
+    OBJDIRS="$OBJDIRS $src/$obj"
+
+    $MAKE -C $src host HOSTOBJDIR=$obj HOSTTARGET=$obj/main_host $defs \
+        >$dest/build.log 2>&1 || {
+        echo "compare_builds.sh: build of $name failed, see $dest/build.log" >&2
+        exit 1
+    }
+
+    $NM -S -C --defined-only $src/$obj/main_host >$dest/main.csym
+    $SIZE $src/$obj/main_host >$dest/main.size
+
+    if $MAKE -C $src benchrun HOSTOBJDIR=$obj BENCH_SCENARIO=$SCENARIO_PATH $defs \
+        >$dest/bench.log 2>&1; then
+        cp $src/$obj/bench.tsv $dest/main.bench.tsv
+    else
+        echo "compare_builds.sh: no bench for $name, see $dest/bench.log" >&2
+    fi
+}
+
+cleanup() {
+    for obj in $OBJDIRS; do
+        rm -rf $obj
+    done
+    rm -f .dep/obj_compare_*
+    for tree in $WORKTREES; do
+        git worktree remove --force $tree >/dev/null 2>&1
+    done
+}
+
+#----------------------------------------------------------------------------
+# Per symbol size delta.
+#  $1 = section types (nm letters), $2 = title
+report_symbols() {
+    echo
+    echo "== $2 per symbol (host bytes, largest change first)"
+    printf "delta\tbase\tnew\tsymbol\n"
+    $AWK -v types="$1" '
+        # <addr> <size> <type> <name ...>
+        function load(file, table,    line, n, f, name, i) {
+            while ((getline line < file) > 0) {
+                n = split(line, f, " ")
+                # Symbols without a size have no bytes to compare
+                if ((n < 4) || (f[2] !~ /^[0-9a-f]+$/)) continue
+                if (index(types, f[3]) == 0) continue
+                name = f[4]
+                for (i = 5; i <= n; i++) name = name " " f[i]
+                table[name] += hex(f[2])
+                seen[name] = 1
+            }
+            close(file)
+        }
+        function hex(s,    v, i) {
+            v = 0
+            for (i = 1; i <= length(s); i++) v = v * 16 + index("0123456789abcdef", substr(s, i, 1)) - 1
+            return v
+        }
+        BEGIN {
+            load(ARGV[1], base)
+            load(ARGV[2], new)
+            for (name in seen) {
+                d = new[name] - base[name]
+                if (d == 0) continue
+                r = (d < 0) ? -d : d
+                printf "%d\t%+d\t%d\t%d\t%s\n", r, d, base[name], new[name], name
+            }
+            exit
+        }' $OUTDIR/base/main.csym $OUTDIR/new/main.csym \
+    | sort -t "	" -k1,1 -n -r | cut -f 2-
+}
+
+# text/data/bss totals from size
+report_totals() {
+    echo
+    echo "== Totals (host bytes)"
+    $AWK '
+        function load(file, t,    line, f) {
+            getline line < file
+            getline line < file
+            split(line, f, " ")
+            t["text"] = f[1]; t["data"] = f[2]; t["bss"] = f[3]
+            close(file)
+        }
+        BEGIN {
+            load(ARGV[1], b)
+            load(ARGV[2], n)
+            printf "text\t%d -> %d (%+d)\n", b["text"], n["text"], n["text"] - b["text"]
+            printf "data\t%d -> %d (%+d)\n", b["data"], n["data"], n["data"] - b["data"]
+            printf "bss\t%d -> %d (%+d)\n", b["bss"], n["bss"], n["bss"] - b["bss"]
+            exit
+        }' $OUTDIR/base/main.size $OUTDIR/new/main.size
+}
+
+#----------------------------------------------------------------------------
+# Time delta from the isr_bench tables
+report_bench() {
+    echo
+    if test ! -s $OUTDIR/base/main.bench.tsv || test ! -s $OUTDIR/new/main.bench.tsv; then
+        echo "== Bench: no isr_bench results for both builds"
+        return
+    fi
+    echo "== Host ns per call (isr_bench, largest avg change first)"
+    printf "avg_delta\tavg_base\tavg_new\tmax_base\tmax_new\tcount_base\tcount_new\tpath\n"
+    $AWK -F "\t" '
+        # engine path count per_sec min_ns avg_ns max_ns
+        function load(file, avg, max, count,    line, f) {
+            while ((getline line < file) > 0) {
+                if (line ~ /^engine\t/) continue
+                split(line, f, "\t")
+                avg[f[2]] = f[6]
+                max[f[2]] = f[7]
+                count[f[2]] = f[3]
+                seen[f[2]] = 1
+            }
+            close(file)
+        }
+        BEGIN {
+            load(ARGV[1], abase, mbase, cbase)
+            load(ARGV[2], anew, mnew, cnew)
+            for (name in seen) {
+                d = anew[name] - abase[name]
+                r = (d < 0) ? -d : d
+                printf "%d\t%+d\t%d\t%d\t%d\t%d\t%d\t%d\t%s\n", r, d \
+                      ,abase[name], anew[name], mbase[name], mnew[name] \
+                      ,cbase[name], cnew[name], name
+            }
+            exit
+        }' $OUTDIR/base/main.bench.tsv $OUTDIR/new/main.bench.tsv \
+    | sort -t "	" -k1,1 -n -r | cut -f 2-
+}
+
+#----------------------------------------------------------------------------
+
+if test $REPORT_ONLY -eq 0; then
+    if test $# -lt 1; then
+        usage
+    fi
+    BASE_REV=$1
+    NEW_REV=${2:-.}
+
+    if test -z "$OUTDIR"; then
+        OUTDIR=`mktemp -d ${TMPDIR:-/tmp}/compare_builds.XXXXXX` || exit 1
+    fi
+    SCENARIO_PATH=`cd \`dirname $SCENARIO\` && pwd`/`basename $SCENARIO`
+    OBJDIRS=
+    WORKTREES=
+    trap cleanup EXIT
+    trap 'exit 1' HUP INT PIPE TERM
+
+    build_rev base "$BASE_REV" "$BASE_DEFS"
+    build_rev new "$NEW_REV" "$NEW_DEFS"
+
+    echo "== results kept in $OUTDIR" >&2
+fi
+
+report_totals
+# Code: text (T/t), weak (W/w), read only (R/r).  RAM: data (D/d), bss (B/b)
+report_symbols "TtWwRr" "Code"
+report_symbols "DdBb" "RAM"
+report_bench
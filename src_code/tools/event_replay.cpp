@@ -0,0 +1,416 @@
+/****************************************************
+    Event Replay
+
+    File:   tools/event_replay.cpp
+    Author: agent
+    agent AT local
+
+    tools/event_replay.cpp file is part of the RGB LED Controller and Node 
+     version 1 hardware project.
+
+    This file contains the host replay tool for event captures.  A
+     firmware built with EVENT_CAPTURE=1 sends every dequeued event as
+     a 5 byte msg (hardware, event, data, stamp) ahead of the msgs
+     the state machine sends while processing it.  The tool feeds the
+     captured events back into rgb_controller_state_machine::process()
+     as fast as the host allows, checks that the msgs sent for each
+     event match the capture and reports the throughput and the cost
+     of each state.
+
+    The capture is either the "tx XX" lines printed by main_host, a
+     list of hex bytes (whitespace separated) or, with -b, the raw
+     bytes read from the serial port.
+
+    Usage:
+      event_replay [-b] [-v] capture_file    ("-" reads stdin)
+
+    Exit status is 0 when every msg matched, 1 on a mismatch.
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+
+*****************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef _HAL_HOST_H_
+#include "hal_host.h"
+#endif
+
+#ifndef _EVENT_QUEUE_H_
+#include "event_queue.h"
+#endif
+
+#ifndef _RGB_CONTROLLER_STATE_MACHINE_H_
+#include "rgb_controller_state_machine.h"
+#endif
+
+// Length of the msgs in a capture
+#define CAPTURE_MSG_LENGTH 5
+#define EVENT_MSG_LENGTH 3
+
+// Largest msg the deframer keeps
+#define MAX_MSG_LENGTH 32
+
+struct replay_msg
+{
+    uint8_t length;
+    uint8_t data[MAX_MSG_LENGTH];
+};
+
+// Growable list of msgs
+struct replay_msg_list
+{
+    replay_msg *msg;
+    uint32_t count;
+    uint32_t size;
+
+    void clear() { count = 0; }
+
+    replay_msg &append()
+    {
+        if (count == size) {
+            size = size ? size * 2 : 256;
+            msg = (replay_msg *)realloc(msg, size * sizeof(replay_msg));
+            if (!msg) {
+                fprintf(stderr, "event_replay: out of memory\n");
+                exit(2);
+            }
+        }
+        msg[count].length = 0;
+        return msg[count++];
+    }
+};
+
+// HDLC like deframer, same framing as comm_class
+struct replay_deframer
+{
+    replay_msg_list *list;
+    replay_msg current;
+    bool escape;
+    bool overrun;
+
+    void put(uint8_t const aByte)
+    {
+        if (aByte == UartBaseClass::COMM_CLASS_FLAG_BYTE) {
+            if (current.length && !overrun) {
+                list->append() = current;
+            }
+            current.length = 0;
+            escape = false;
+            overrun = false;
+            return;
+        }
+
+        uint8_t data = aByte;
+        if (escape) {
+            data ^= UartBaseClass::COMM_CLASS_BYTE_STUFF_XOR_VALUE;
+            escape = false;
+        } else if (aByte == UartBaseClass::COMM_CLASS_ESCAPE_CHAR_START) {
+            escape = true;
+            return;
+        }
+
+        if (current.length < MAX_MSG_LENGTH) {
+            current.data[current.length++] = data;
+        } else {
+            overrun = true;
+        }
+    }
+};
+
+// One event of the capture and the msgs the firmware sent for it
+struct replay_event
+{
+    event_element_class event;
+    uint16_t stamp;
+    uint32_t first_msg;
+    uint32_t msg_count;
+};
+
+class event_replay
+{
+public:
+    static int main(int argc, char *argv[]);
+
+private:
+    typedef base_state_class::STATE STATE;
+
+    struct state_cost
+    {
+        char const *name;
+        STATE state;
+        uint32_t count;
+        uint64_t total_ns;
+        uint64_t max_ns;
+    };
+
+    static bool Load(char const *aFile, bool const &aBinary);
+    static uint32_t Replay();
+    static void Report(uint32_t const &aMismatches);
+    static state_cost *Lookup(STATE const aState);
+    static void TxSink(uint8_t const &aByte);
+    static uint64_t Nanoseconds();
+
+    static replay_msg_list _Capture;
+    static replay_msg_list _Sent;
+    static replay_deframer _SentDeframer;
+    static replay_event *_Events;
+    static uint32_t _EventCount;
+    static bool _Verbose;
+
+    static state_cost _Cost[];
+    static uint64_t _ProcessNs;
+    static uint64_t _WallNs;
+};
+
+#define REPLAY_STATE(x) { #x, (base_state_class::STATE)&rgb_controller_state_machine::x, 0, 0, 0 }
+
+event_replay::state_cost event_replay::_Cost[] = {
+     REPLAY_STATE(STATE_IDLE)
+    ,REPLAY_STATE(STATE_BUTTON_1_PRESSED)
+    ,REPLAY_STATE(STATE_BUTTON_2_PRESSED)
+    ,REPLAY_STATE(STATE_BUTTON_3_PRESSED)
+    ,REPLAY_STATE(STATE_BUTTON_1_PLUS_BUTTON_2_PRESSED)
+    ,REPLAY_STATE(STATE_BUTTON_1_PLUS_BUTTON_3_PRESSED)
+    ,REPLAY_STATE(STATE_BUTTON_2_PLUS_BUTTON_3_PRESSED)
+    ,REPLAY_STATE(STATE_BUTTON_1_PLUS_BUTTON_2_PLUS_BUTTON_3)
+    ,REPLAY_STATE(STATE_LED_SELECT)
+    ,REPLAY_STATE(STATE_LED_SELECT_COLOR_MODE_SELECT)
+    ,REPLAY_STATE(STATE_LED_SELECT_AWAKE_LED_STATUS)
+    ,REPLAY_STATE(STATE_LED_SELECT_PRESSED)
+    // Must be the last entry
+    ,{ "(unknown)", 0, 0, 0, 0 }
+};
+
+#define REPLAY_STATE_COUNT (sizeof(event_replay::_Cost) / sizeof(event_replay::_Cost[0]))
+
+replay_msg_list event_replay::_Capture;
+replay_msg_list event_replay::_Sent;
+replay_deframer event_replay::_SentDeframer;
+replay_event *event_replay::_Events = 0;
+uint32_t event_replay::_EventCount = 0;
+bool event_replay::_Verbose = false;
+uint64_t event_replay::_ProcessNs = 0;
+uint64_t event_replay::_WallNs = 0;
+
+uint64_t event_replay::Nanoseconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+void event_replay::TxSink(uint8_t const &aByte)
+{
+    _SentDeframer.put(aByte);
+}
+
+event_replay::state_cost *event_replay::Lookup(STATE const aState)
+{
+    uint8_t i;
+    for (i = 0; i < REPLAY_STATE_COUNT - 1; i++) {
+        if (_Cost[i].state == aState) break;
+    }
+    return &_Cost[i];
+}
+
+bool event_replay::Load(char const *aFile, bool const &aBinary)
+{
+    FILE *f = strcmp(aFile, "-") ? fopen(aFile, "rb") : stdin;
+    if (!f) {
+        perror(aFile);
+        return false;
+    }
+
+    replay_deframer deframer;
+    memset(&deframer, 0, sizeof(deframer));
+    deframer.list = &_Capture;
+
+    if (aBinary) {
+        int c;
+        while ((c = fgetc(f)) != EOF) {
+            deframer.put((uint8_t)c);
+        }
+    } else {
+        // Every token that is a hex byte is data.  "tx" and
+        //  anything after a # is skipped.
+        char line[256];
+        while (fgets(line, sizeof(line), f)) {
+            char *hash = strchr(line, '#');
+            if (hash) *hash = 0;
+            for (char *tok = strtok(line, " \t\r\n"); tok; tok = strtok(0, " \t\r\n")) {
+                char *end;
+                unsigned long const value = strtoul(tok, &end, 16);
+                if ((*end == 0) && (end != tok) && (value <= 0xFF)) {
+                    deframer.put((uint8_t)value);
+                }
+            }
+        }
+    }
+
+    if (f != stdin) fclose(f);
+
+    // Split the capture into events and the msgs sent for them
+    _Events = (replay_event *)calloc(_Capture.count + 1, sizeof(replay_event));
+    uint32_t skipped = 0;
+    for (uint32_t i = 0; i < _Capture.count; i++) {
+        replay_msg const &m = _Capture.msg[i];
+        if (m.length == CAPTURE_MSG_LENGTH) {
+            replay_event &e = _Events[_EventCount++];
+            e.event.set((E_InputHardware)m.data[0], (E_InputEvent)m.data[1], m.data[2]);
+            e.stamp = m.data[3] | (m.data[4] << 8);
+            e.first_msg = i + 1;
+            e.msg_count = 0;
+        } else if (_EventCount && (m.length == EVENT_MSG_LENGTH)) {
+            _Events[_EventCount - 1].msg_count++;
+        } else {
+            skipped++;
+        }
+    }
+
+    if (skipped) {
+        fprintf(stderr, "event_replay: %u msgs outside of a captured event skipped\n", skipped);
+    }
+    return true;
+}
+
+uint32_t event_replay::Replay()
+{
+    EventQueue event_queue;
+    rgb_controller_state_machine RGB_Controller(&event_queue);
+
+    hal_host::SetTxSink(TxSink);
+    _SentDeframer.list = &_Sent;
+
+    sei();
+
+    uint32_t mismatches = 0;
+    uint64_t const start = Nanoseconds();
+
+    for (uint32_t i = 0; i < _EventCount; i++) {
+        replay_event const &e = _Events[i];
+        state_cost *cost = Lookup(RGB_Controller.state);
+
+        _Sent.clear();
+
+        uint64_t const t0 = Nanoseconds();
+        RGB_Controller.process(e.event);
+        uint64_t const t1 = Nanoseconds();
+
+        // Send whatever is still in the UART buffer
+        hal_host::Service();
+
+        // Events queued while processing are in the capture already
+        event_element_class discard;
+        while (event_queue.Dequeue(discard)) {}
+
+        uint64_t const ns = t1 - t0;
+        _ProcessNs += ns;
+        cost->count++;
+        cost->total_ns += ns;
+        if (ns > cost->max_ns) cost->max_ns = ns;
+
+        // Compare the msgs sent with the capture
+        bool match = (_Sent.count == e.msg_count);
+        for (uint32_t m = 0; match && (m < e.msg_count); m++) {
+            replay_msg const &want = _Capture.msg[e.first_msg + m];
+            match = (_Sent.msg[m].length == want.length)
+                 && !memcmp(_Sent.msg[m].data, want.data, want.length);
+        }
+
+        if (!match) {
+            mismatches++;
+            if (_Verbose || (mismatches == 1)) {
+                printf("mismatch event %u (%02X %02X %02X) in %s: sent %u msgs, captured %u\n"
+                      ,i
+                      ,e.event.get_current_hardware()
+                      ,e.event.get_current_event()
+                      ,e.event.get_current_data()
+                      ,cost->name
+                      ,_Sent.count
+                      ,e.msg_count);
+            }
+        }
+    }
+
+    _WallNs = Nanoseconds() - start;
+    return mismatches;
+}
+
+void event_replay::Report(uint32_t const &aMismatches)
+{
+    printf("events\t%u\n", _EventCount);
+    if (_EventCount) {
+        printf("stamps\t%u..%u\n", _Events[0].stamp, _Events[_EventCount - 1].stamp);
+    }
+    printf("mismatches\t%u\n", aMismatches);
+    printf("process_ns\t%llu\n", (unsigned long long)_ProcessNs);
+    printf("wall_ns\t%llu\n", (unsigned long long)_WallNs);
+    if (_ProcessNs) {
+        printf("events_per_sec\t%.0f\n", _EventCount * 1e9 / _ProcessNs);
+    }
+
+    printf("\nstate\tcount\tavg_ns\tmax_ns\ttotal_ns\n");
+    for (uint8_t i = 0; i < REPLAY_STATE_COUNT; i++) {
+        state_cost const &c = _Cost[i];
+        if (!c.count) continue;
+        printf("%s\t%u\t%llu\t%llu\t%llu\n"
+              ,c.name
+              ,c.count
+              ,(unsigned long long)(c.total_ns / c.count)
+              ,(unsigned long long)c.max_ns
+              ,(unsigned long long)c.total_ns);
+    }
+}
+
+int event_replay::main(int argc, char *argv[])
+{
+    bool binary = false;
+    char const *file = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-b")) binary = true;
+        else if (!strcmp(argv[i], "-v")) _Verbose = true;
+        else file = argv[i];
+    }
+
+    if (!file) {
+        fprintf(stderr, "usage: event_replay [-b] [-v] capture_file\n");
+        return 2;
+    }
+
+    if (!Load(file, binary)) return 2;
+
+    // The firmware state machine is built once.  The display and the
+    //  timer attach to their subjects and never detach.
+    uint32_t const mismatches = Replay();
+    Report(mismatches);
+
+    return mismatches ? 1 : 0;
+}
+
+int main(int argc, char *argv[])
+{
+    return event_replay::main(argc, argv);
+}
@@ -0,0 +1,203 @@
+/****************************************************
+    ISR Benchmark
+
+    File:   tools/isr_bench.cpp
+    Author: agent
+    agent AT local
+
+    tools/isr_bench.cpp file is part of the RGB LED Controller and Node
+     version 1 hardware project.
+
+    This file contains the host benchmark of the interrupt paths.  It is
+     linked with the whole host firmware, main() included, and runs the
+     stimulus script on stdin (host/hal_host.h) like main_host.  Every
+     ISR dispatched and every base_state_class::process() call (wrapped
+     by the linker, see "make bench") is timed with the host clock.
+
+    Times are host nanoseconds of the code itself, the ISRs nested in
+     it are taken out.  They rank the paths against each other and
+     against a baseline built the same way, they are not AVR cycles.
+     count and per_sec are the simulated ATmega328p's and are exact.
+
+    Output is a tab separated table on stdout when the script ends:
+      engine  path  count  per_sec  min_ns  avg_ns  max_ns
+     The bytes the firmware transmits are dropped.
+
+    Usage:
+      isr_bench < script.txt
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+
+*****************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#ifndef _HAL_HOST_H_
+#include "hal_host.h"
+#endif
+
+#ifndef _HAL_INTERRUPTS_H_
+#include "hal_interrupts.h"
+#endif
+
+#ifndef _STATE_CLASS_H_
+#include "state_class.h"
+#endif
+
+#if PWM_ENGINE == PWM_ENGINE_TICK
+#define BENCH_ENGINE "tick"
+#elif PWM_ENGINE == PWM_ENGINE_EDGE
+#define BENCH_ENGINE "edge"
+#elif PWM_ENGINE == PWM_ENGINE_PORT
+#define BENCH_ENGINE "port"
+#else
+#define BENCH_ENGINE "bam"
+#endif
+
+// Row of the process() calls, after the vectors
+#define BENCH_PROCESS _VECTORS_SIZE
+#define BENCH_ROWS (_VECTORS_SIZE + 1)
+
+// Deepest nesting timed: process() and every vector once
+#define BENCH_DEPTH (BENCH_ROWS + 1)
+
+struct bench_row
+{
+    uint32_t count;
+    uint64_t total_ns;
+    uint64_t min_ns;
+    uint64_t max_ns;
+};
+
+// Code being timed, the ISRs nested in it are taken out
+struct bench_frame
+{
+    uint8_t row;
+    uint64_t start_ns;
+    uint64_t nested_ns;
+};
+
+static bench_row rows[BENCH_ROWS];
+static bench_frame stack[BENCH_DEPTH];
+static uint8_t depth = 0;
+
+static char const *const vector_name[_VECTORS_SIZE] = {
+     "RESET",        "INT0",         "INT1",         "PCINT0"
+    ,"PCINT1",       "PCINT2",       "WDT",          "TIMER2_COMPA"
+    ,"TIMER2_COMPB", "TIMER2_OVF",   "TIMER1_CAPT",  "TIMER1_COMPA"
+    ,"TIMER1_COMPB", "TIMER1_OVF",   "TIMER0_COMPA", "TIMER0_COMPB"
+    ,"TIMER0_OVF",   "SPI_STC",      "USART_RX",     "USART_UDRE"
+    ,"USART_TX",     "ADC",          "EE_READY",     "ANALOG_COMP"
+    ,"TWI",          "SPM_READY"
+};
+
+static uint64_t nanoseconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void enter(uint8_t const &aRow)
+{
+    if (depth == BENCH_DEPTH) {
+        fprintf(stderr, "isr_bench: nested too deep\n");
+        exit(2);
+    }
+    stack[depth].row = aRow;
+    stack[depth].nested_ns = 0;
+    stack[depth].start_ns = nanoseconds();
+    depth++;
+}
+
+static void leave()
+{
+    uint64_t const now = nanoseconds();
+    bench_frame const &f = stack[--depth];
+    uint64_t const total = now - f.start_ns;
+    uint64_t const self = total - f.nested_ns;
+
+    if (depth) stack[depth - 1].nested_ns += total;
+
+    bench_row &r = rows[f.row];
+    if (!r.count || (self < r.min_ns)) r.min_ns = self;
+    if (self > r.max_ns) r.max_ns = self;
+    r.total_ns += self;
+    r.count++;
+}
+
+static void dispatch_hook(uint8_t const &aVector, bool const &aEnter)
+{
+    if (aEnter) enter(aVector);
+    else leave();
+}
+
+static void drop_tx(uint8_t const &)
+{
+}
+
+static void report()
+{
+    double const seconds = (double)hal_host::Cycles() / F_CPU;
+
+    printf("engine\tpath\tcount\tper_sec\tmin_ns\tavg_ns\tmax_ns\n");
+    for (uint8_t i = 0; i < BENCH_ROWS; i++) {
+        bench_row const &r = rows[i];
+        if (!r.count) continue;
+        printf("%s\t%s\t%u\t%.0f\t%llu\t%llu\t%llu\n"
+              ,BENCH_ENGINE
+              ,(i == BENCH_PROCESS) ? "process" : vector_name[i]
+              ,r.count
+              ,r.count / seconds
+              ,(unsigned long long)r.min_ns
+              ,(unsigned long long)(r.total_ns / r.count)
+              ,(unsigned long long)r.max_ns);
+    }
+}
+
+// Hooked in after hal_host_power_on(), before main() runs
+static struct isr_bench
+{
+    isr_bench()
+    {
+        hal_host::SetDispatchHook(dispatch_hook);
+        hal_host::SetTxSink(drop_tx);
+        atexit(report);
+    }
+} bench;
+
+// The linker sends main()'s calls of base_state_class::process() here
+//  (-Wl,--wrap, see "make bench")
+#define PROCESS_SYMBOL _ZN16base_state_class7processERK19event_element_class
+#define PASTE(a, b) a##b
+#define WRAP(s) PASTE(__wrap_, s)
+#define REAL(s) PASTE(__real_, s)
+
+extern "C" void REAL(PROCESS_SYMBOL)(base_state_class *aThis, event_element_class const &A);
+
+extern "C" void WRAP(PROCESS_SYMBOL)(base_state_class *aThis, event_element_class const &A)
+{
+    enter(BENCH_PROCESS);
+    REAL(PROCESS_SYMBOL)(aThis, A);
+    leave();
+}
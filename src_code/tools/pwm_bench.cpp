@@ -0,0 +1,183 @@
+/****************************************************
+    PWM Engine Benchmark
+
+    File:   tools/pwm_bench.cpp
+    Author: agent
+    agent AT local
+
+    tools/pwm_bench.cpp file is part of the RGB LED Controller and Node
+     version 1 hardware project.
+
+    This file contains the host benchmark of the software PWM engine
+     per channel.  The LEDs on PC0..PC5 are lit one more at a time, at
+     levels apart from each other, and the Timer2 compare ISR is timed
+     over PWM_BENCH_FRAMES frames for every count of lit channels.  The
+     step from one row to the next is the cost of one channel.  The
+     setValue() calls (gamma table, PWM_GAMMA) are timed on their own.
+
+    Times are host nanoseconds of the code itself, the lowest of
+     PWM_BENCH_RUNS runs.  They rank the engines and configurations
+     against each other, they are not AVR cycles.  isr_per_frame is
+     the simulated ATmega328p's and is exact.
+
+    Output is a tab separated table on stdout:
+      engine  gamma  dither  path  channels  count  ns
+     path TIMER2_COMPA: count is interrupts per frame, ns per frame
+     path setValue:     count is calls, ns per call
+
+    Usage:
+      pwm_bench
+
+    Copyright (C) 2026 - agent - 2026 Oct 17
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    Rev History:
+     When         Who                Description of change
+    -----------  ----------         ------------------------
+    2026 Oct 17  agent              Initial creation.
+
+*****************************************************/
+
+#include <stdio.h>
+#include <time.h>
+
+#ifndef _HAL_HOST_H_
+#include "hal_host.h"
+#endif
+
+#ifndef _PWM_CLASS_H_
+#include "pwm_class.h"
+#endif
+
+#if PWM_ENGINE == PWM_ENGINE_TICK
+#define BENCH_ENGINE "tick"
+#elif PWM_ENGINE == PWM_ENGINE_EDGE
+#define BENCH_ENGINE "edge"
+#elif PWM_ENGINE == PWM_ENGINE_PORT
+#define BENCH_ENGINE "port"
+#else
+#define BENCH_ENGINE "bam"
+#endif
+
+#define PWM_BENCH_FRAMES 16
+#define PWM_BENCH_RUNS 60
+#define PWM_BENCH_CALLS 25400
+
+static IOPinDefines::E_PinDef const bench_pin[] = {
+     IOPinDefines::E_PIN_PC0, IOPinDefines::E_PIN_PC1, IOPinDefines::E_PIN_PC2
+    ,IOPinDefines::E_PIN_PC3, IOPinDefines::E_PIN_PC4, IOPinDefines::E_PIN_PC5
+};
+#define BENCH_CHANNELS (sizeof(bench_pin) / sizeof(bench_pin[0]))
+
+// Levels of the channels, apart so every channel has its own edge
+static uint8_t const bench_level[BENCH_CHANNELS] = { 0x18, 0x40, 0x68, 0x90, 0xB8, 0xE0 };
+
+static uint64_t nanoseconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// Timer2 compare ISR time, the ISRs nested in it are taken out
+static uint64_t isr_ns;
+static uint64_t isr_start[_VECTORS_SIZE];
+static uint64_t isr_nested[_VECTORS_SIZE];
+static uint8_t isr_stack[_VECTORS_SIZE];
+static uint8_t isr_depth = 0;
+
+static void dispatch_hook(uint8_t const &aVector, bool const &aEnter)
+{
+    uint64_t const now = nanoseconds();
+    if (aEnter) {
+        isr_stack[isr_depth++] = aVector;
+        isr_start[aVector] = now;
+        isr_nested[aVector] = 0;
+        return;
+    }
+
+    uint8_t const vector = isr_stack[--isr_depth];
+    uint64_t const total = now - isr_start[vector];
+    if (isr_depth) isr_nested[isr_stack[isr_depth - 1]] += total;
+    if (vector == TIMER2_COMPA_vect_num) isr_ns += total - isr_nested[vector];
+}
+
+static void drop_tx(uint8_t const &)
+{
+}
+
+// Lowest Timer2 host ns per frame of the runs, interrupts per frame
+static uint64_t frame_ns(uint32_t &aInterrupts)
+{
+    uint64_t best = ~0ULL;
+
+    for (uint8_t run = 0; run < PWM_BENCH_RUNS; run++) {
+        uint32_t const start = hal_host::VectorCount(TIMER2_COMPA_vect_num);
+        isr_ns = 0;
+        hal_host::AdvanceTime(PWM_BENCH_FRAMES * PWM_FRAME_CYCLES);
+        aInterrupts = (hal_host::VectorCount(TIMER2_COMPA_vect_num) - start) / PWM_BENCH_FRAMES;
+        if (isr_ns < best) best = isr_ns;
+    }
+    return best / PWM_BENCH_FRAMES;
+}
+
+// Lowest host ns of a setValue() call, levels 1..254 in turn
+static uint64_t set_value_ns(pwm_class &aLED, uint8_t const &aLevel)
+{
+    uint64_t best = ~0ULL;
+
+    for (uint8_t run = 0; run < PWM_BENCH_RUNS; run++) {
+        uint64_t const start = nanoseconds();
+        for (uint32_t ii = 0; ii < PWM_BENCH_CALLS; ii++) {
+            aLED.setValue(1 + (ii % 254));
+        }
+        uint64_t const ns = nanoseconds() - start;
+        if (ns < best) best = ns;
+    }
+    aLED.setValue(aLevel);
+    return best / PWM_BENCH_CALLS;
+}
+
+int main()
+{
+    hal_host::SetDispatchHook(dispatch_hook);
+    hal_host::SetTxSink(drop_tx);
+
+    pwm_class *led[BENCH_CHANNELS];
+    for (uint8_t ii = 0; ii < BENCH_CHANNELS; ii++) {
+        led[ii] = new pwm_class(bench_pin[ii], true, 0);
+    }
+    sei();
+
+    printf("engine\tgamma\tdither\tpath\tchannels\tcount\tns\n");
+    for (uint8_t lit = 0; lit <= BENCH_CHANNELS; lit++) {
+        if (lit) led[lit - 1]->setValue(bench_level[lit - 1]);
+        // The duty shows from the frame after the next frame start
+        hal_host::AdvanceTime(2 * PWM_FRAME_CYCLES);
+
+        uint32_t interrupts = 0;
+        uint64_t const ns = frame_ns(interrupts);
+        printf("%s\t%d\t%d\tTIMER2_COMPA\t%u\t%u\t%llu\n"
+              ,BENCH_ENGINE, PWM_GAMMA, PWM_DITHER_BITS
+              ,lit, interrupts, (unsigned long long)ns);
+    }
+
+    uint64_t const ns = set_value_ns(*led[0], bench_level[0]);
+    printf("%s\t%d\t%d\tsetValue\t-\t%u\t%llu\n"
+          ,BENCH_ENGINE, PWM_GAMMA, PWM_DITHER_BITS
+          ,PWM_BENCH_CALLS, (unsigned long long)ns);
+
+    return 0;
+}
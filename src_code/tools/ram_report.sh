@@ -0,0 +1,120 @@
+#!/bin/sh
+#****************************************************
+#
+#    ram_report.sh file is part of the CPP AVR build
+#     system.  It is called by "make ramreport" to show where the
+#     RAM of the firmware goes.
+#
+#    - Reads the "nm -S" output of the host firmware objects.
+#    - Sums the data (D/d) and bss (B/b) symbols of every object.
+#    - Prints the RAM per module, largest first, the largest
+#       symbols and the total.
+#    - Prints the largest stack frames from the .su files next to
+#       the objects (-fstack-usage), when there are any.  main()'s
+#       frame holds the objects main.cpp keeps on the stack: the
+#       state machine, the EventQueue, the buttons and LEDs.
+#
+#    The sizes are the host (x86-64) build's.  Pointers and vtable
+#     pointers take 8 bytes instead of 2, so the totals are larger
+#     than the AVR ones.  The ranking and the growth of a buffer
+#     carry over.  Heap and the deepest stack reached are not in it,
+#     RAM_USAGE=1 measures them on the part (report request 0x03).
+#
+#    Usage:
+#      ram_report.sh [-n symbols] object...
+#
+#    Environment: NM
+#
+#    agent  - 2026 Oct 17
+#    agent AT local
+#
+#*****************************************************/
+
+AWK=awk
+NM=${NM:-nm}
+
+SYMBOLS=15
+
+usage() {
+    echo "Usage: ram_report.sh [-n symbols] object..." >&2
+    exit 1
+}
+
+while getopts "n:" opt; do
+    case $opt in
+    n) SYMBOLS=$OPTARG ;;
+    *) usage ;;
+    esac
+done
+shift `expr $OPTIND - 1`
+
+if test $# -lt 1; then
+    usage
+fi
+
+# <module> <size> <type> <name ...> of every sized data/bss symbol
+for obj in "$@"; do
+    $NM -S -C --defined-only $obj | $AWK -v module=`basename $obj .o` '
+        (NF >= 4) && ($3 ~ /^[DdBb]$/) {
+            name = $4
+            for (i = 5; i <= NF; i++) name = name " " $i
+            print module "\t" $2 "\t" $3 "\t" name
+        }'
+done > ${TMPDIR:-/tmp}/ram_report.$$
+
+$AWK -F "\t" -v symbols=$SYMBOLS '
+    function hex(s,    v, i) {
+        v = 0
+        for (i = 1; i <= length(s); i++) v = v * 16 + index("0123456789abcdef", substr(s, i, 1)) - 1
+        return v
+    }
+    {
+        size = hex($2)
+        if (($3 == "D") || ($3 == "d")) data[$1] += size
+        else bss[$1] += size
+        seen[$1] = 1
+        sym[++count] = size "\t" $1 "\t" $4
+        total += size
+        if (($3 == "D") || ($3 == "d")) total_data += size
+        else total_bss += size
+    }
+    END {
+        print "== RAM per module (host bytes, largest first)"
+        print "total\tdata\tbss\tmodule"
+        for (m in seen) printf "%d\t%d\t%d\t%s\n", data[m] + bss[m], data[m], bss[m], m | "sort -t \"\t\" -k1,1 -n -r"
+        close("sort -t \"\t\" -k1,1 -n -r")
+
+        print ""
+        print "== Largest " symbols " symbols (host bytes)"
+        print "size\tmodule\tsymbol"
+        for (i = 1; i <= count; i++) print sym[i] | "sort -t \"\t\" -k1,1 -n -r | head -n " symbols
+        close("sort -t \"\t\" -k1,1 -n -r | head -n " symbols)
+
+        print ""
+        print "== Total (host bytes)"
+        printf "data\t%d\nbss\t%d\ntotal\t%d\n", total_data, total_bss, total
+    }' ${TMPDIR:-/tmp}/ram_report.$$
+
+rm -f ${TMPDIR:-/tmp}/ram_report.$$
+
+# <file:line:col:function> <bytes> <static/dynamic/bounded>
+for obj in "$@"; do
+    su=`dirname $obj`/`basename $obj .o`.su
+    test -f $su && cat $su
+done > ${TMPDIR:-/tmp}/ram_report.$$
+
+if test -s ${TMPDIR:-/tmp}/ram_report.$$; then
+    echo
+    echo "== Largest $SYMBOLS stack frames (host bytes)"
+    printf "size\ttype\tfunction\n"
+    $AWK -F "\t" '
+        {
+            # The function follows the file:line:col: prefix
+            name = $1
+            sub(/^[^:]*:[0-9]+:[0-9]+:/, "", name)
+            print $2 "\t" $3 "\t" name
+        }' ${TMPDIR:-/tmp}/ram_report.$$ \
+    | sort -t "	" -k1,1 -n -r | head -n $SYMBOLS
+fi
+
+rm -f ${TMPDIR:-/tmp}/ram_report.$$
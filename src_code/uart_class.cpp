@@ -121,6 +121,13 @@ Date        Description
                                       into a class.  The only
                                       advantage this gives is
                                       automatic initialization.
+    2026 Oct 17  agent              RX notifications deferred to
+                                      the main loop.
+    2026 Oct 17  agent              Every byte of a batch checked
+                                      for the flag, RX work posted
+                                      again with DEFERRED_WORK=0.
+    2026 Oct 17  agent              putc() asserts interrupts are on
+                                      before it waits.
 
 *****************************************************/
 
@@ -128,6 +135,20 @@ Date        Description
 #include "uart_class.h"
 #endif
 
+#include <assert.h>
+
+#ifndef _ISR_PROFILE_H_
+#include "isr_profile.h"
+#endif
+
+#ifndef _POWER_STATS_H_
+#include "power_stats.h"
+#endif
+
+#ifndef _DEFERRED_WORK_H_
+#include "deferred_work.h"
+#endif
+
 // Set to 1 to have this class generate these events
 #define NOTIFY_OF_TX_COMPLETE_EVENTS 0
 #define NOTIFY_OF_RX_EVENTS 1
@@ -137,8 +158,11 @@ UartBaseClass* UartBaseClass::pUart = 0;
 
 UartBaseClass::UartBaseClass(E_InputHardware A)
 : event_element_class(A,E_LAST_INPUT_EVENT)
+, _RxPosted(false)
+, _RxScanned(0)
 {
     pUart = this;
+    deferred_work::Register(deferred_work::E_WORK_USART_RX, &UartBaseClass::received);
 
     // Notify the sleep class that the USART interface is in use.
     mcu_sleep_class::getInstance()->SetInterfaceUsage(
@@ -156,6 +180,7 @@ void UartBaseClass::init(uint8_t baudrate)
     UART_TxTail = 0;
     UART_RxHead = 0;
     UART_RxTail = 0;
+    _RxScanned = 0;
 
     /* Set baud rate */
     if ( baudrate & 0x8000 ) {
@@ -237,10 +262,17 @@ void UartBaseClass::putc(uint8_t const data)
     tmphead  = (UART_TxHead + 1) & UART_TX0_BUFFER_MASK;
 
     if ( tmphead == UART_TxTail ) {
+        // Only the UDRE interrupt frees space, with interrupts off
+        //  the wait below never ends
+        assert(SREG & (1<<SREG_I));
+
         // Enable UDRE and Force a TX interrupt
         UART0_CONTROL |= (1<<UART0_UDRIE);
 
-        ;/* wait for free space in buffer */
+        /* wait for free space in buffer, polling the USART status */
+        while ( tmphead == UART_TxTail ) {
+            (void)UART0_STATUS;
+        }
     }
 
     UART_TxBuf[tmphead] = data;
@@ -286,6 +318,10 @@ void UartBaseClass::receive()
     /* */
     lastRxError = (usr & ((1<<FE0)|(1<<DOR0)) );
 
+    if (usr & (1<<DOR0)) {
+        ISR_PROFILE_UART_OVERRUN();
+    }
+
     /* calculate buffer index */
     tmphead = ( UART_RxHead + 1) & UART_RX0_BUFFER_MASK;
 
@@ -300,20 +336,47 @@ void UartBaseClass::receive()
     }
     UART_LastRxError = lastRxError;
 
+    // One work item covers every byte received until it runs, the
+    //  comm class decodes all of them.
+    //  Set before the post, with DEFERRED_WORK=0 the post runs
+    //  received() right away and that clears it again.
+    if (!_RxPosted)
+    {
+        _RxPosted = true;
+        if (!deferred_work::Post(deferred_work::E_WORK_USART_RX, data))
+        {
+            _RxPosted = false;
+        }
+    }
+}
+
+void UartBaseClass::received(uint8_t const &data)
+{
+    // Bytes received from here on need another work item
+    pUart->_RxPosted = false;
+
+    (void)data;
+
 #if NOTIFY_OF_FLAG_BYTE_EVENTS
-    // Notify listener of this event.
-    if (data == COMM_CLASS_FLAG_BYTE)
+    // Notify listener of every flag byte received since the last
+    //  run, the work item only carries the first byte of the batch.
+    uint8_t const head = pUart->UART_RxHead;
+    while (pUart->_RxScanned != head)
     {
-        event_element_class A;
-        A.set(get_current_hardware(),E_InputEvent::E_UART_FLAG_BYTE_FOUND_EVENT);
-        Notify(A);
+        pUart->_RxScanned = (pUart->_RxScanned + 1) & UART_RX0_BUFFER_MASK;
+        if (pUart->UART_RxBuf[pUart->_RxScanned] == COMM_CLASS_FLAG_BYTE)
+        {
+            event_element_class A;
+            A.set(pUart->get_current_hardware(),E_InputEvent::E_UART_FLAG_BYTE_FOUND_EVENT);
+            pUart->Notify(A);
+        }
     }
 #endif
 
 #if NOTIFY_OF_RX_EVENTS
     event_element_class A;
-    A.set(get_current_hardware(),E_InputEvent::E_UART_RX_EVENT);
-    Notify(A);
+    A.set(pUart->get_current_hardware(),E_InputEvent::E_UART_RX_EVENT);
+    pUart->Notify(A);
 #endif
 }
 
@@ -342,13 +405,19 @@ void UartBaseClass::transmit()
 
 ISR(USART_RX_vect)
 {
+    POWER_STATS_WAKE(E_ISR_USART_RX);
+    ISR_PROFILE_ENTER();
     UartBaseClass::pUart->receive();
+    ISR_PROFILE_EXIT(E_ISR_USART_RX);
 }
 
 
 ISR(USART_UDRE_vect)
 {
+    POWER_STATS_WAKE(E_ISR_USART_UDRE);
+    ISR_PROFILE_ENTER();
     UartBaseClass::pUart->transmit();
+    ISR_PROFILE_EXIT(E_ISR_USART_UDRE);
 }
 
 
@@ -125,6 +125,9 @@ Date        Description
                                       into a class.  The only
                                       advantage this gives is
                                       automatic initialization.
+    2026 Oct 17  agent              Flag bytes of a batch scanned
+                                      by received().
+    2026 Oct 17  agent              putc() blocking documented.
 
 *****************************************************/
 
@@ -210,6 +213,9 @@ public:
     void flush();
 
     bool getc(uint8_t &error, uint8_t &data);
+    // Queues a byte for the UDRE interrupt.  Blocks while the TX
+    //  buffer is full until the interrupt frees a slot: up to a byte
+    //  time (10 bits at BAUD).  Call with interrupts on, it asserts.
     void putc(uint8_t const data);
 
 #if 0
@@ -223,6 +229,9 @@ public:
     void receive();
     void transmit();
 
+    // Notifies the observer of the bytes received (deferred from the ISR)
+    static void received(uint8_t const &data);
+
     static UartBaseClass* pUart;
 
     // 0x7E is a flag byte for Start/Stop of a frame.
@@ -245,6 +254,12 @@ private:
     volatile uint8_t UART_RxTail;
     volatile uint8_t UART_LastRxError;
 
+    // A deferred received() is outstanding
+    volatile bool _RxPosted;
+
+    // Last byte received() checked for the flag
+    uint8_t _RxScanned;
+
 };
 
 #endif